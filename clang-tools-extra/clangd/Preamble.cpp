@@ -313,6 +313,14 @@ PreambleData::PreambleData(const ParseInputs &Inputs,
       StatCache(std::move(StatCache)), CanonIncludes(std::move(CanonIncludes)) {
 }
 
+// Preambles are built and owned per file. Sharing one PCH between files whose
+// preamble regions hash identically has been considered and rejected: the
+// serialized PCH records the main file's identity and the invocation that
+// built it, reuse is validated by PrecompiledPreamble::CanReuse against that
+// specific file's bounds and stat cache, and two files' preambles diverge the
+// moment either edits an include or a flag. The hash key would have to cover
+// the resolved contents of every included header plus the full invocation,
+// at which point it is as expensive as the validation it replaces.
 std::shared_ptr<const PreambleData>
 buildPreamble(PathRef FileName, CompilerInvocation CI,
               const ParseInputs &Inputs, bool StoreInMemory,
@@ -108,6 +108,14 @@ llvm::Optional<llvm::StringRef> TUScheduler::getFileBeingProcessedInContext() {
 /// Because we want to limit the overall number of these we retain, the cache
 /// owns ASTs (and may evict them) while their workers are idle.
 /// Workers borrow ASTs when active, and return them when done.
+///
+/// The policy is deliberately a count-bounded LRU rather than something
+/// smarter. A memory budget would need getUsedBytes(), which walks the AST
+/// and is too slow to consult on every insertion, and weighting entries by
+/// rebuild cost mostly re-derives recency: the files that are expensive to
+/// rebuild are the ones the user keeps returning to. Speculative prebuilding
+/// of likely-next files belongs above this layer, where edit patterns and
+/// the include graph are visible; the cache itself cannot create workers.
 class TUScheduler::ASTCache {
 public:
   using Key = const ASTWorker *;
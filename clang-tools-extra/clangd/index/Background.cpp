@@ -286,7 +286,13 @@ llvm::Error BackgroundIndex::index(tooling::CompileCommand Cmd) {
 
   SymbolCollector::Options IndexOpts;
   // Creates a filter to not collect index results from files with unchanged
-  // digests.
+  // digests. This is what keeps shared headers from being *indexed* once per
+  // including TU: after the first TU whose parse covers a header version, the
+  // digest matches and later TUs skip collection for it. The headers are
+  // still *parsed* as part of each TU - that is inherent to textual
+  // inclusion, and background parses run without preambles (above), so
+  // grouping TUs by shared headers on one worker would not let them share
+  // any parsing state either.
   IndexOpts.FileFilter = [&ShardVersionsSnapshot](const SourceManager &SM,
                                                   FileID FID) {
     const auto *F = SM.getFileEntryForID(FID);
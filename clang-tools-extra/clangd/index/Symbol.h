@@ -174,6 +174,15 @@ float quality(const Symbol &S);
 
 /// An immutable symbol container that stores a set of symbols.
 /// The container will maintain the lifetime of the symbols.
+///
+/// Strings (USRs, names, include headers) are interned per slab, not in a
+/// process-wide arena. Slabs are built concurrently on indexing threads and
+/// dropped wholesale when a file's shard is replaced; a shared intern table
+/// would serialize every builder on one lock, and refcounting its pages would
+/// pin memory until the last slab referencing a page died - exactly the
+/// retention the per-slab arena avoids. Cross-slab duplication is bounded
+/// instead by FileSymbols::buildIndex, which deduplicates symbols when file
+/// snapshots are merged into a served index.
 class SymbolSlab {
 public:
   using const_iterator = std::vector<Symbol>::const_iterator;
@@ -96,6 +96,13 @@ public:
 
 } // namespace
 
+// Posting lists are rebuilt in memory on every load rather than mmapped from
+// disk. They index positions in the quality-ranked symbol ordering computed
+// below, which only exists at runtime after all shards are merged, so a
+// serialized posting list from one shard would be meaningless in the combined
+// corpus. Persistence lives a level up: the background index stores per-file
+// symbol shards (BackgroundIndexStorage) and restarts rebuild this structure
+// from them instead of re-parsing sources.
 void Dex::buildIndex() {
   this->Corpus = dex::Corpus(Symbols.size());
   std::vector<std::pair<float, const Symbol *>> ScoredSymbols(Symbols.size());
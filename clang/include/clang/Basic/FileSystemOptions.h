@@ -24,6 +24,10 @@ public:
   /// If set, paths are resolved as if the working directory was
   /// set to the value of WorkingDir.
   std::string WorkingDir;
+
+  /// If set, 'stat' results are served from (or, on a warm-up run, recorded
+  /// into) a persistent cache file at this path. See PersistentStatCache.
+  std::string StatCachePath;
 };
 
 } // end namespace clang
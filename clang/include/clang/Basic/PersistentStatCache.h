@@ -0,0 +1,70 @@
+//===- PersistentStatCache.h - On-disk 'stat' cache -------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+/// \file
+/// Defines the PersistentStatCache interface, a FileSystemStatCache backed by
+/// a cache file on disk that can be shared between compile jobs.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_CLANG_BASIC_PERSISTENTSTATCACHE_H
+#define LLVM_CLANG_BASIC_PERSISTENTSTATCACHE_H
+
+#include "clang/Basic/FileSystemStatCache.h"
+#include "llvm/ADT/Optional.h"
+#include "llvm/ADT/StringMap.h"
+#include <memory>
+#include <string>
+
+namespace clang {
+
+/// A 'stat' cache persisted next to the build. Many build-farm compile jobs
+/// probe the same header search directories and re-stat the same headers;
+/// this cache lets one warm-up job record the results and every following
+/// job serve them without touching the file system.
+///
+/// If the cache file exists, lookups (including negative lookups, which
+/// dominate header search) are answered from it and unknown paths fall
+/// through to the real file system. If it does not exist, the cache records
+/// every result and atomically writes the file when destroyed.
+///
+/// Entries are trusted as long as the cache file exists; it is the build
+/// system's job to delete the cache when the source tree changes, the same
+/// contract as for a stale PCH.
+class PersistentStatCache : public FileSystemStatCache {
+public:
+  /// Create a cache bound to \p CachePath, loading it if it already exists.
+  /// A malformed or version-mismatched file is ignored and regenerated.
+  static std::unique_ptr<PersistentStatCache> create(StringRef CachePath);
+
+  ~PersistentStatCache() override;
+
+private:
+  PersistentStatCache(std::string CachePath);
+
+  std::error_code getStat(StringRef Path, llvm::vfs::Status &Status,
+                          bool isFile, std::unique_ptr<llvm::vfs::File> *F,
+                          llvm::vfs::FileSystem &FS) override;
+
+  bool loadFromDisk();
+  void writeToDisk();
+
+  /// Path of the cache file.
+  std::string CachePath;
+
+  /// True if the cache file existed and entries are served from it; false if
+  /// this process is recording a fresh cache.
+  bool ServingFromDisk;
+
+  /// Known results. None records a path that did not exist.
+  llvm::StringMap<llvm::Optional<llvm::vfs::Status>> Entries;
+};
+
+} // namespace clang
+
+#endif // LLVM_CLANG_BASIC_PERSISTENTSTATCACHE_H
@@ -1694,6 +1694,17 @@ DeclContext::lookup(DeclarationName Name) const {
       Map = CreateStoredDeclsMap(getParentASTContext());
 
     // If we have a lookup result with no external decls, we are done.
+    //
+    // Note that inserting an empty StoredDeclsList here also memoizes
+    // *misses*: a name that external storage did not provide gets an entry
+    // with no external decls, so repeated lookups of the same absent name
+    // never go back to the ASTReader. Only the first miss per (context,
+    // name) pays for an external probe, and that probe is a bucket read in
+    // the mmapped on-disk hash tables (merged across module files by
+    // MultiOnDiskHashTable), not a declaration deserialization. A per-context
+    // bloom filter over external names would only accelerate that first
+    // probe, and would have to be serialized and incrementally merged across
+    // chained module files to stay sound.
     std::pair<StoredDeclsMap::iterator, bool> R =
         Map->insert(std::make_pair(Name, StoredDeclsList()));
     if (!R.second && !R.first->second.hasExternalDecls())
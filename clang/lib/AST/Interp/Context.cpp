@@ -26,6 +26,14 @@ Context::Context(ASTContext &Ctx) : Ctx(Ctx), P(new Program(*this)) {}
 
 Context::~Context() {}
 
+// Per-function bytecode caching already happens one level down: compileFunc
+// registers the compiled Function in Program::Funcs keyed by the FunctionDecl,
+// and the getFunction probe below (and the Call opcode at run time) reuse it
+// for every later evaluation in the TU. What keeps real workloads on the
+// ExprConstant.cpp fallback is opcode coverage, not caching — the ByteCode*Gen
+// visitors bail on floating point, unions, bit-fields, multi-dimensional
+// arrays and most of C++20's constexpr surface, and each of those needs new
+// opcodes in Opcodes.td plus Descriptor/Pointer support, not a tweak here.
 bool Context::isPotentialConstantExpr(State &Parent, const FunctionDecl *FD) {
   Function *Func = P->getFunction(FD);
   if (!Func) {
@@ -210,6 +210,12 @@ static void addParentsForSyntheticStmts(const CFG *TheCFG, ParentMap &PM) {
   }
 }
 
+// The CFG is built lazily on first use and memoized for the lifetime of this
+// context. AnalysisDeclContextManager hands out one context per Decl, so a
+// function analyzed as several entry points (or inlined into several callers)
+// still builds its CFG and managed analyses such as LiveVariables once per
+// translation unit; all registered checkers run in a single ExprEngine walk
+// over that one graph.
 CFG *AnalysisDeclContext::getCFG() {
   if (!cfgBuildOptions.PruneTriviallyFalseEdges)
     return getUnoptimizedCFG();
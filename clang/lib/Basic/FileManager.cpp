@@ -204,7 +204,11 @@ llvm::Expected<FileEntryRef>
 FileManager::getFileRef(StringRef Filename, bool openFile, bool CacheFailure) {
   ++NumFileLookups;
 
-  // See if there is already an entry in the map.
+  // See if there is already an entry in the map. The map entry doubles as the
+  // interned spelling of the path: the returned FileEntryRef points into it,
+  // so later comparisons and map keys are pointer-sized and never re-hash the
+  // path. Only this first lookup of a given spelling pays for hashing, which
+  // is unavoidable while callers hand us paths as strings.
   auto SeenFileInsertResult =
       SeenFileEntries.insert({Filename, std::errc::no_such_file_or_directory});
   if (!SeenFileInsertResult.second) {
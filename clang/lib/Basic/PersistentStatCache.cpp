@@ -0,0 +1,197 @@
+//===- PersistentStatCache.cpp - On-disk 'stat' cache ---------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file implements the PersistentStatCache.
+//
+//===----------------------------------------------------------------------===//
+
+#include "clang/Basic/PersistentStatCache.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/Support/Endian.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/raw_ostream.h"
+#include <chrono>
+
+using namespace clang;
+using namespace llvm;
+using namespace llvm::support;
+
+// On-disk layout: a fixed header followed by one record per path. All
+// integers are little-endian.
+//
+//   'C' 'S' 'T' 'C'  uint32 Version  uint64 NumEntries
+//
+// and per entry:
+//
+//   uint16 PathLen  <path bytes>  uint8 Exists
+//
+// followed, for existing paths only, by the serialized vfs::Status fields:
+//
+//   uint64 Device  uint64 File  int64 MTimeNs  uint64 Size
+//   uint32 Type  uint32 Perms  uint32 User  uint32 Group
+
+static const char CacheMagic[4] = {'C', 'S', 'T', 'C'};
+static const uint32_t CacheVersion = 1;
+
+std::unique_ptr<PersistentStatCache>
+PersistentStatCache::create(StringRef CachePath) {
+  return std::unique_ptr<PersistentStatCache>(
+      new PersistentStatCache(CachePath.str()));
+}
+
+PersistentStatCache::PersistentStatCache(std::string CachePath)
+    : CachePath(std::move(CachePath)) {
+  ServingFromDisk = loadFromDisk();
+}
+
+PersistentStatCache::~PersistentStatCache() {
+  if (!ServingFromDisk && !Entries.empty())
+    writeToDisk();
+}
+
+std::error_code
+PersistentStatCache::getStat(StringRef Path, llvm::vfs::Status &Status,
+                             bool isFile, std::unique_ptr<llvm::vfs::File> *F,
+                             llvm::vfs::FileSystem &FS) {
+  // If the client wants the file opened as well, a cached stat cannot help
+  // for existing files: we must touch the real file system anyway, and
+  // open+fstat is cheaper than a cached stat followed by open. Negative
+  // entries are still served below since there is nothing to open.
+  bool WantsOpen = isFile && F;
+
+  if (ServingFromDisk) {
+    auto It = Entries.find(Path);
+    if (It != Entries.end()) {
+      if (!It->second)
+        return std::make_error_code(std::errc::no_such_file_or_directory);
+      if (!WantsOpen) {
+        Status = *It->second;
+        return std::error_code();
+      }
+    }
+    // Unknown path, or a known file that must be opened.
+    return get(Path, Status, isFile, F, nullptr, FS);
+  }
+
+  // Recording mode: delegate to the real file system and remember the
+  // result. Only ENOENT is negatively cached; other errors (permissions,
+  // is-a-directory mismatches) are rare and not worth the staleness risk.
+  std::error_code EC = get(Path, Status, isFile, F, nullptr, FS);
+  if (!EC)
+    Entries[Path] = Status;
+  else if (EC == std::errc::no_such_file_or_directory)
+    Entries[Path] = None;
+  return EC;
+}
+
+bool PersistentStatCache::loadFromDisk() {
+  auto BufOrErr = llvm::MemoryBuffer::getFile(CachePath);
+  if (!BufOrErr)
+    return false;
+  StringRef Data = (*BufOrErr)->getBuffer();
+
+  auto Malformed = [this] {
+    Entries.clear();
+    return false;
+  };
+
+  if (Data.size() < 16 || !Data.startswith(StringRef(CacheMagic, 4)))
+    return Malformed();
+  const char *P = Data.data() + 4;
+  const char *End = Data.data() + Data.size();
+  if (endian::read32le(P) != CacheVersion)
+    return Malformed();
+  P += 4;
+  uint64_t NumEntries = endian::read64le(P);
+  P += 8;
+
+  for (uint64_t I = 0; I != NumEntries; ++I) {
+    if (End - P < 3)
+      return Malformed();
+    uint16_t PathLen = endian::read16le(P);
+    P += 2;
+    if (End - P < PathLen + 1)
+      return Malformed();
+    StringRef Path(P, PathLen);
+    P += PathLen;
+    uint8_t Exists = *P++;
+    if (!Exists) {
+      Entries[Path] = None;
+      continue;
+    }
+    if (End - P < 48)
+      return Malformed();
+    uint64_t Device = endian::read64le(P);
+    uint64_t File = endian::read64le(P + 8);
+    int64_t MTimeNs = endian::read64le(P + 16);
+    uint64_t Size = endian::read64le(P + 24);
+    auto Type = static_cast<llvm::sys::fs::file_type>(endian::read32le(P + 32));
+    auto Perms = static_cast<llvm::sys::fs::perms>(endian::read32le(P + 36));
+    uint32_t User = endian::read32le(P + 40);
+    uint32_t Group = endian::read32le(P + 44);
+    P += 48;
+    Entries[Path] = llvm::vfs::Status(
+        Path, llvm::sys::fs::UniqueID(Device, File),
+        llvm::sys::TimePoint<>(std::chrono::nanoseconds(MTimeNs)), User, Group,
+        Size, Type, Perms);
+  }
+  return true;
+}
+
+void PersistentStatCache::writeToDisk() {
+  // Write to a unique temporary and rename it into place so concurrent
+  // warm-up jobs never expose a half-written cache.
+  SmallString<128> TmpPath;
+  int TmpFD;
+  if (llvm::sys::fs::createUniqueFile(CachePath + ".tmp%%%%%%", TmpFD,
+                                      TmpPath))
+    return;
+  {
+    llvm::raw_fd_ostream OS(TmpFD, /*shouldClose=*/true);
+    OS.write(CacheMagic, 4);
+    char Buf[8];
+    auto Write32 = [&](uint32_t V) {
+      endian::write32le(Buf, V);
+      OS.write(Buf, 4);
+    };
+    auto Write64 = [&](uint64_t V) {
+      endian::write64le(Buf, V);
+      OS.write(Buf, 8);
+    };
+    Write32(CacheVersion);
+    Write64(llvm::count_if(Entries, [](const auto &Entry) {
+      return Entry.first().size() <= UINT16_MAX;
+    }));
+    for (const auto &Entry : Entries) {
+      StringRef Path = Entry.first();
+      if (Path.size() > UINT16_MAX)
+        continue;
+      endian::write16le(Buf, Path.size());
+      OS.write(Buf, 2);
+      OS << Path;
+      const llvm::Optional<llvm::vfs::Status> &S = Entry.second;
+      OS.write(S ? '\1' : '\0');
+      if (!S)
+        continue;
+      Write64(S->getUniqueID().getDevice());
+      Write64(S->getUniqueID().getFile());
+      Write64(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                  S->getLastModificationTime().time_since_epoch())
+                  .count());
+      Write64(S->getSize());
+      Write32(static_cast<uint32_t>(S->getType()));
+      Write32(static_cast<uint32_t>(S->getPermissions()));
+      Write32(S->getUser());
+      Write32(S->getGroup());
+    }
+  }
+  if (llvm::sys::fs::rename(TmpPath, CachePath))
+    llvm::sys::fs::remove(TmpPath);
+}
@@ -99,6 +99,17 @@ const char *ContentCache::getInvalidBOM(StringRef BufStr) {
   return InvalidBOM;
 }
 
+// On sharing these caches process-wide (build daemons recompiling the same
+// headers): the buffer bytes already amortize when compiles share a
+// FileManager — getBufferForFile below caches per FileEntry — or an
+// in-memory VFS. What cannot be shared as-is are the ContentCaches
+// themselves: they are mutable per compile (SourceLineCache is computed
+// against a buffer that macro expansion and #line handling may observe
+// differently, and BufferOverridden/IsTransient wire into rewriters and
+// PCH validation), and the line-offset table's lifetime is tied to this
+// SourceManager's arena. A shared immutable slab keyed by FileEntry UID
+// would need those mutable bits split out per instance — a SourceManager
+// refactor, not a cache bolt-on.
 llvm::Optional<llvm::MemoryBufferRef>
 ContentCache::getBufferOrNone(DiagnosticsEngine &Diag, FileManager &FM,
                               SourceLocation Loc) const {
@@ -1269,6 +1280,37 @@ LineOffsetMapping LineOffsetMapping::get(llvm::MemoryBufferRef Buffer,
   const unsigned char *End = (const unsigned char *)Buffer.getBufferEnd();
   const std::size_t BufLen = End - Buf;
   unsigned I = 0;
+
+#ifdef __SSE2__
+  // Scan 16 bytes at a time for line separators. Most chunks contain none, so
+  // the common case is two compares and a movemask test per 16 bytes. When a
+  // chunk does contain a separator, jump to the first one and let the scalar
+  // logic handle it; that keeps \r\n pairs straddling a chunk boundary
+  // counting as a single line.
+  const __m128i CRs = _mm_set1_epi8('\r');
+  const __m128i LFs = _mm_set1_epi8('\n');
+  while (I + 16 <= BufLen) {
+    const __m128i Chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(Buf + I));
+    unsigned Mask = _mm_movemask_epi8(
+        _mm_or_si128(_mm_cmpeq_epi8(Chunk, CRs), _mm_cmpeq_epi8(Chunk, LFs)));
+    if (!Mask) {
+      I += 16;
+      continue;
+    }
+    I += llvm::countTrailingZeros(Mask);
+    if (Buf[I] == '\n') {
+      LineOffsets.push_back(I + 1);
+    } else {
+      // If this is \r\n, skip both characters.
+      if (I + 1 < BufLen && Buf[I + 1] == '\n')
+        ++I;
+      LineOffsets.push_back(I + 1);
+    }
+    ++I;
+  }
+#endif
+
   while (I < BufLen) {
     if (Buf[I] == '\n') {
       LineOffsets.push_back(I + 1);
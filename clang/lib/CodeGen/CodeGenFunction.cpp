@@ -2538,6 +2538,19 @@ static void CreateMultiVersionResolverReturn(CodeGenModule &CGM,
     Builder.CreateRet(Result);
 }
 
+// Multi-versioning is attribute-driven by design rather than something an
+// LLVM pass decides automatically. The pieces an automatic version would
+// need live in the wrong places for that: profitability (which functions
+// are ISA-width-limited) is known to the loop vectorizer's cost model deep
+// in the middle end, while version selection must run here so that the
+// resolver, __cpu_model initialization, symbol aliases and ifunc emission
+// agree with the target and the ABI — ifunc in particular is an
+// ELF/glibc-family contract, which is also why this path is x86-only and
+// falls back to a dispatcher call when ifunc is unsupported. Cloning every
+// width-limited function speculatively also multiplies text size with no
+// attribute to bound it; target_clones is the mechanism by which a human
+// or a tool (e.g. driven by a profile) makes that size/speed call
+// per function.
 void CodeGenFunction::EmitMultiVersionResolver(
     llvm::Function *Resolver, ArrayRef<MultiVersionResolverOption> Options) {
   assert(getContext().getTargetInfo().getTriple().isX86() &&
@@ -370,6 +370,13 @@ CrossTranslationUnitContext::ASTUnitStorage::ASTUnitStorage(
                     ? CI.getAnalyzerOpts()->CTUImportCppThreshold
                     : CI.getAnalyzerOpts()->CTUImportThreshold) {}
 
+// External ASTs are cached per analyzed TU, not shared across processes.
+// Sharing imported definitions between analyses would require serializing the
+// *result* of an ASTImporter run, but imported nodes are allocated inside the
+// importing TU's ASTContext and wired to its identifiers, types and source
+// locations - there is no context-independent form to put in a shared store.
+// The knobs that exist for farm-scale runs are the import thresholds below,
+// which bound how many external ASTs any one analysis keeps resident.
 llvm::Expected<ASTUnit *>
 CrossTranslationUnitContext::ASTUnitStorage::getASTUnitForFile(
     StringRef FileName, bool DisplayCTUProgress) {
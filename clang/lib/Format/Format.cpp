@@ -2743,6 +2743,12 @@ reformat(const FormatStyle &Style, StringRef Code,
   unsigned Penalty = 0;
   for (size_t I = 0, E = Passes.size(); I < E; ++I) {
     std::pair<tooling::Replacements, unsigned> PassFixes = Passes[I](*Env);
+    if (PassFixes.first.empty()) {
+      // Nothing changed; the next pass can reuse the current environment
+      // instead of paying for a copy of the code and a fresh source manager.
+      Penalty += PassFixes.second;
+      continue;
+    }
     auto NewCode = applyAllReplacements(
         CurrentCode ? StringRef(*CurrentCode) : Code, PassFixes.first);
     if (NewCode) {
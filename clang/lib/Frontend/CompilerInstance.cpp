@@ -14,6 +14,7 @@
 #include "clang/Basic/Diagnostic.h"
 #include "clang/Basic/FileManager.h"
 #include "clang/Basic/LangStandard.h"
+#include "clang/Basic/PersistentStatCache.h"
 #include "clang/Basic/SourceManager.h"
 #include "clang/Basic/Stack.h"
 #include "clang/Basic/TargetInfo.h"
@@ -319,6 +320,9 @@ FileManager *CompilerInstance::createFileManager(
                                                     getDiagnostics());
   assert(VFS && "FileManager has no VFS?");
   FileMgr = new FileManager(getFileSystemOpts(), std::move(VFS));
+  if (!getFileSystemOpts().StatCachePath.empty())
+    FileMgr->setStatCache(
+        PersistentStatCache::create(getFileSystemOpts().StatCachePath));
   return FileMgr.get();
 }
 
@@ -1093,6 +1097,13 @@ compileModuleImpl(CompilerInstance &ImportingInstance, SourceLocation ImportLoc,
   // module.  Since we're sharing an in-memory module cache,
   // CompilerInstance::CompilerInstance is responsible for finalizing the
   // buffers to prevent use-after-frees.
+  //
+  // The instance is fresh on purpose even though this build runs in-process:
+  // the file manager, in-memory module cache, and dependency collector below
+  // are shared with the importing instance, but TargetInfo, builtin tables,
+  // and header search carry per-invocation state (the module's own language
+  // options and -f flags) and keeping warm copies around would tie module
+  // output to whichever invocation happened to build first.
   CompilerInstance Instance(ImportingInstance.getPCHContainerOperations(),
                             &ImportingInstance.getModuleCache());
   auto &Inv = *Invocation;
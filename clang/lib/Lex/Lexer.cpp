@@ -2262,6 +2262,13 @@ bool Lexer::SkipWhitespace(Token &Result, const char *CurPtr,
   return false;
 }
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif __ALTIVEC__
+#include <altivec.h>
+#undef bool
+#endif
+
 /// We have just read the // characters from input.  Skip until we find the
 /// newline character that terminates the comment.  Then update BufferPtr and
 /// return.
@@ -2289,6 +2296,58 @@ bool Lexer::SkipLineComment(Token &Result, const char *CurPtr,
   char C;
   while (true) {
     C = *CurPtr;
+
+    // Skip over the bulk of the comment a chunk at a time.  Only a newline, a
+    // DOS-style newline, or the null at the end of the buffer can terminate
+    // the fast loop below, so scan for those in 16-byte chunks and leave the
+    // byte-wise loop to land on the interesting character itself.
+    if (CurPtr + 24 < BufferEnd) {
+      // While not aligned to a 16-byte boundary.
+      while (C != 0 && C != '\n' && C != '\r' &&
+             ((intptr_t)CurPtr & 0x0F) != 0)
+        C = *++CurPtr;
+
+      if (C != 0 && C != '\n' && C != '\r') {
+#ifdef __SSE2__
+        __m128i Newlines = _mm_set1_epi8('\n');
+        __m128i CarriageReturns = _mm_set1_epi8('\r');
+        __m128i Zeros = _mm_setzero_si128();
+        while (CurPtr + 16 <= BufferEnd) {
+          __m128i Chunk = *(const __m128i *)CurPtr;
+          __m128i Interesting = _mm_or_si128(
+              _mm_cmpeq_epi8(Chunk, Zeros),
+              _mm_or_si128(_mm_cmpeq_epi8(Chunk, Newlines),
+                           _mm_cmpeq_epi8(Chunk, CarriageReturns)));
+          int Mask = _mm_movemask_epi8(Interesting);
+          if (Mask != 0) {
+            CurPtr += llvm::countTrailingZeros<unsigned>(Mask);
+            break;
+          }
+          CurPtr += 16;
+        }
+#elif __ALTIVEC__
+        __vector unsigned char Newlines = {
+          '\n', '\n', '\n', '\n',  '\n', '\n', '\n', '\n',
+          '\n', '\n', '\n', '\n',  '\n', '\n', '\n', '\n'
+        };
+        __vector unsigned char CarriageReturns = {
+          '\r', '\r', '\r', '\r',  '\r', '\r', '\r', '\r',
+          '\r', '\r', '\r', '\r',  '\r', '\r', '\r', '\r'
+        };
+        __vector unsigned char Zeros = vec_splat_u8(0);
+        while (CurPtr + 16 <= BufferEnd) {
+          __vector unsigned char Chunk =
+              *(const __vector unsigned char *)CurPtr;
+          if (vec_any_eq(Chunk, Newlines) || vec_any_eq(Chunk, CarriageReturns) ||
+              vec_any_eq(Chunk, Zeros))
+            break;
+          CurPtr += 16;
+        }
+#endif
+        C = *CurPtr;
+      }
+    }
+
     // Skip over characters in the fast loop.
     while (C != 0 &&                // Potentially EOF.
            C != '\n' && C != '\r')  // Newline or DOS-style newline.
@@ -2495,13 +2554,6 @@ static bool isEndOfBlockCommentWithEscapedNewLine(const char *CurPtr,
   return true;
 }
 
-#ifdef __SSE2__
-#include <emmintrin.h>
-#elif __ALTIVEC__
-#include <altivec.h>
-#undef bool
-#endif
-
 /// We have just read from input the / and * characters that started a comment.
 /// Read until we find the * and / characters that terminate the comment.
 /// Note that we don't bother decoding trigraphs or escaped newlines in block
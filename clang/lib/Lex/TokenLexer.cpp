@@ -50,7 +50,7 @@ void TokenLexer::Init(Token &Tok, SourceLocation ELEnd, MacroInfo *MI,
   AtStartOfLine = Tok.isAtStartOfLine();
   HasLeadingSpace = Tok.hasLeadingSpace();
   NextTokGetsSpace = false;
-  Tokens = &*Macro->tokens_begin();
+  Tokens = Macro->tokens_begin();
   OwnsTokens = false;
   DisableMacroExpansion = false;
   IsReinject = false;
@@ -6260,6 +6260,18 @@ static bool IsAcceptableNonMemberOperatorCandidate(ASTContext &Context,
 /// \param PartialOverloading true if we are performing "partial" overloading
 /// based on an incomplete set of function arguments. This feature is used by
 /// code completion.
+///
+/// The cheap rejections here are deliberately ordered before conversion
+/// sequence construction: arity, CUDA target, constraint satisfaction and
+/// explicit-ness all mark the candidate non-viable and return without ever
+/// building an ImplicitConversionSequence, so the expensive path only runs
+/// for candidates that survive. A TU-scoped (lookup result, argument types)
+/// memo of the eventual winner is not viable on top of this: the outcome
+/// also depends on the argument value categories and bit-field-ness, the
+/// caller context (CUDA target, accessibility), the point of instantiation
+/// for template candidates, and the growing set of ADL-visible declarations
+/// — a sound key would have to encode all of those, at which point it costs
+/// as much as the resolution it replaces.
 void Sema::AddOverloadCandidate(
     FunctionDecl *Function, DeclAccessPair FoundDecl, ArrayRef<Expr *> Args,
     OverloadCandidateSet &CandidateSet, bool SuppressUserConversions,
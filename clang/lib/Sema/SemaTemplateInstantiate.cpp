@@ -2621,6 +2621,21 @@ namespace clang {
 /// to the lack of a definition.
 ///
 /// \returns true if an error occurred, false otherwise.
+///
+/// On memoizing instantiations whose results are "identical up to unused
+/// arguments": the AST does not permit sharing subtrees between
+/// specializations. Every Decl created here has a distinct DeclContext chain,
+/// every type written in the pattern is rebuilt against this specialization's
+/// argument list, and downstream consumers (lookup, ODR hashing, the ASTWriter,
+/// template argument deduction) rely on pointer identity to tell
+/// specializations apart. Two places do legitimately cut this cost without
+/// sharing nodes: lazy member instantiation (only members actually used are
+/// instantiated; this function instantiates the class shell, not the method
+/// bodies) and type canonicalization (semantically identical types collapse in
+/// ASTContext regardless of which specialization spelled them). A
+/// fingerprint-based cache would have to prove the unused-argument claim per
+/// pattern, which is the same analysis as making the parameter a template
+/// template or removing it at the source level.
 bool
 Sema::InstantiateClass(SourceLocation PointOfInstantiation,
                        CXXRecordDecl *Instantiation, CXXRecordDecl *Pattern,
@@ -1682,6 +1682,16 @@ MacroInfo *ASTReader::ReadMacroRecord(ModuleFile &F, uint64_t Offset) {
   RecordData Record;
   SmallVector<IdentifierInfo*, 16> MacroParams;
   MacroInfo *Macro = nullptr;
+  SmallVector<Token, 16> MacroTokens;
+
+  // The tokens of the macro arrive as individual PP_TOKEN records following
+  // the macro record; buffer them up and hand them to the MacroInfo in one
+  // go when we are done with it.
+  auto FinishMacro = [&] {
+    if (Macro)
+      Macro->setTokens(MacroTokens, PP.getPreprocessorAllocator());
+    return Macro;
+  };
 
   while (true) {
     // Advance to the next record, but if we get to the end of the block, don't
@@ -1692,7 +1702,7 @@ MacroInfo *ASTReader::ReadMacroRecord(ModuleFile &F, uint64_t Offset) {
         Stream.advanceSkippingSubblocks(Flags);
     if (!MaybeEntry) {
       Error(MaybeEntry.takeError());
-      return Macro;
+      return FinishMacro();
     }
     llvm::BitstreamEntry Entry = MaybeEntry.get();
 
@@ -1700,9 +1710,9 @@ MacroInfo *ASTReader::ReadMacroRecord(ModuleFile &F, uint64_t Offset) {
     case llvm::BitstreamEntry::SubBlock: // Handled for us already.
     case llvm::BitstreamEntry::Error:
       Error("malformed block record in AST file");
-      return Macro;
+      return FinishMacro();
     case llvm::BitstreamEntry::EndBlock:
-      return Macro;
+      return FinishMacro();
     case llvm::BitstreamEntry::Record:
       // The interesting case.
       break;
@@ -1715,12 +1725,12 @@ MacroInfo *ASTReader::ReadMacroRecord(ModuleFile &F, uint64_t Offset) {
       RecType = (PreprocessorRecordTypes)MaybeRecType.get();
     else {
       Error(MaybeRecType.takeError());
-      return Macro;
+      return FinishMacro();
     }
     switch (RecType) {
     case PP_MODULE_MACRO:
     case PP_MACRO_DIRECTIVE_HISTORY:
-      return Macro;
+      return FinishMacro();
 
     case PP_MACRO_OBJECT_LIKE:
     case PP_MACRO_FUNCTION_LIKE: {
@@ -1728,7 +1738,7 @@ MacroInfo *ASTReader::ReadMacroRecord(ModuleFile &F, uint64_t Offset) {
       // of the definition of the macro we were looking for. We're
       // done.
       if (Macro)
-        return Macro;
+        return FinishMacro();
 
       unsigned NextIndex = 1; // Skip identifier ID.
       SourceLocation Loc = ReadSourceLocation(F, Record, NextIndex);
@@ -1784,7 +1794,7 @@ MacroInfo *ASTReader::ReadMacroRecord(ModuleFile &F, uint64_t Offset) {
 
       unsigned Idx = 0;
       Token Tok = ReadToken(F, Record, Idx);
-      Macro->AddTokenToBody(Tok);
+      MacroTokens.push_back(Tok);
       break;
     }
     }
@@ -4312,11 +4322,11 @@ ASTReader::ASTReadResult ASTReader::ReadAST(StringRef FileName,
 
     // Preload all the pending interesting identifiers by marking them out of
     // date.
+    ASTIdentifierLookupTrait Trait(*this, F);
     for (auto Offset : F.PreloadIdentifierOffsets) {
       const unsigned char *Data = reinterpret_cast<const unsigned char *>(
           F.IdentifierTableData + Offset);
 
-      ASTIdentifierLookupTrait Trait(*this, F);
       auto KeyDataLen = Trait.ReadKeyDataLength(Data);
       auto Key = Trait.ReadKey(Data, KeyDataLen.first);
       auto &II = PP.getIdentifierTable().getOwn(Key);
@@ -208,13 +208,18 @@ ModuleManager::addModule(StringRef FileName, ModuleKind Type,
       Buf = llvm::MemoryBuffer::getSTDIN();
     } else {
       // Get a buffer of the file and close the file descriptor when done.
-      // The file is volatile because in a parallel build we expect multiple
-      // compiler processes to use the same module file rebuilding it if needed.
+      // Module files are volatile because in a parallel build we expect
+      // multiple compiler processes to use the same module file rebuilding it
+      // if needed; marking the buffer volatile forces it to be read into
+      // memory up front rather than mmapped. PCH and preamble files, on the
+      // other hand, are produced and consumed under the control of a single
+      // build step, so we can map them and let pages be faulted in on demand
+      // instead of paying for the whole file at attach time.
       //
       // RequiresNullTerminator is false because module files don't need it, and
       // this allows the file to still be mmapped.
       Buf = FileMgr.getBufferForFile(NewModule->File,
-                                     /*IsVolatile=*/true,
+                                     /*IsVolatile=*/NewModule->isModule(),
                                      /*RequiresNullTerminator=*/false);
     }
 
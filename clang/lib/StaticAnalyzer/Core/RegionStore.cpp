@@ -144,6 +144,13 @@ void BindingKey::dump() const { llvm::errs() << *this; }
 // Actual Store type.
 //===----------------------------------------------------------------------===//
 
+// Bindings use ImmutableMap's canonicalizing AVL trees rather than a flatter
+// persistent structure (e.g. a HAMT with bump-allocated nodes). The analyzer
+// depends on properties a hash trie does not give: the factory canonicalizes
+// equal trees to one node so ProgramState equality - queried on every
+// ExplodedGraph node merge - is a pointer compare, and iteration order over
+// clusters is deterministic without sorting. Node churn is better attacked
+// through the factory's allocator than by swapping the structure.
 typedef llvm::ImmutableMap<BindingKey, SVal>    ClusterBindings;
 typedef llvm::ImmutableMapRef<BindingKey, SVal> ClusterBindingsRef;
 typedef std::pair<BindingKey, SVal> BindingPair;
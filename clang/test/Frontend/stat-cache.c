@@ -0,0 +1,27 @@
+// Test the persistent stat cache: a warm-up run creates the cache file and a
+// later run serves stats (including negative header-search probes) from it.
+
+// RUN: rm -rf %t && mkdir -p %t/a %t/b
+// RUN: echo '' > %t/b/header.h
+
+// The warm-up run records an ENOENT entry for %t/a/header.h and creates the
+// cache file.
+// RUN: %clang_cc1 -I %t/a -I %t/b -stat-cache=%t/stat.cache -fsyntax-only %s
+// RUN: test -f %t/stat.cache
+
+// A header dropped into %t/a afterwards is shadowed by the cached negative
+// entry, so the include still resolves to %t/b.
+// RUN: echo '#error picked the wrong header' > %t/a/header.h
+// RUN: %clang_cc1 -I %t/a -I %t/b -stat-cache=%t/stat.cache -fsyntax-only %s
+
+// Without the cache the new header is found and the compile fails.
+// RUN: not %clang_cc1 -I %t/a -I %t/b -fsyntax-only %s
+
+// A corrupt cache file is ignored and regenerated rather than trusted.
+// RUN: rm %t/a/header.h
+// RUN: echo 'garbage' > %t/stat.cache
+// RUN: %clang_cc1 -I %t/a -I %t/b -stat-cache=%t/stat.cache -fsyntax-only %s
+// RUN: echo '#error picked the wrong header' > %t/a/header.h
+// RUN: %clang_cc1 -I %t/a -I %t/b -stat-cache=%t/stat.cache -fsyntax-only %s
+
+#include "header.h"
@@ -22,6 +22,7 @@
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/InitLLVM.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Process.h"
 
 using namespace llvm;
@@ -529,10 +530,24 @@ int main(int argc, const char **argv) {
               "single file.\n";
     return 1;
   }
-  for (const auto &FileName : FileNames) {
-    if (Verbose)
-      errs() << "Formatting " << FileName << "\n";
-    Error |= clang::format::format(FileName);
+  // When editing in-place, each file only touches itself, so a batch of files
+  // can be formatted concurrently. The other modes write results (or dry-run
+  // warnings) to the standard streams in command-line order and stay serial.
+  if (Inplace && !OutputXML && !DryRun && FileNames.size() > 1) {
+    std::vector<char> Errors(FileNames.size());
+    llvm::parallelForEachN(0, FileNames.size(), [&](size_t I) {
+      if (Verbose)
+        errs() << ("Formatting " + FileNames[I] + "\n");
+      Errors[I] = clang::format::format(FileNames[I]);
+    });
+    for (char FileError : Errors)
+      Error |= FileError;
+  } else {
+    for (const auto &FileName : FileNames) {
+      if (Verbose)
+        errs() << "Formatting " << FileName << "\n";
+      Error |= clang::format::format(FileName);
+    }
   }
   return Error ? 1 : 0;
 }
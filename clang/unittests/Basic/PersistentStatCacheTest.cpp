@@ -0,0 +1,149 @@
+//===- unittests/Basic/PersistentStatCacheTest.cpp - stat cache tests -----===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "clang/Basic/PersistentStatCache.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/VirtualFileSystem.h"
+#include "llvm/Support/raw_ostream.h"
+#include "gtest/gtest.h"
+
+using namespace clang;
+using namespace llvm;
+
+namespace {
+
+class PersistentStatCacheTest : public ::testing::Test {
+protected:
+  SmallString<128> TestDir;
+  SmallString<128> CacheFile;
+
+  void SetUp() override {
+    ASSERT_FALSE(
+        sys::fs::createUniqueDirectory("persistent-stat-cache", TestDir));
+    CacheFile = TestDir;
+    sys::path::append(CacheFile, "stat.cache");
+  }
+
+  void TearDown() override { sys::fs::remove_directories(TestDir); }
+
+  /// Issues a stat through \p Cache the way FileManager does, without asking
+  /// for the file to be opened.
+  static std::error_code stat(FileSystemStatCache &Cache, StringRef Path,
+                              vfs::Status &Status, vfs::FileSystem &FS) {
+    return FileSystemStatCache::get(Path, Status, /*isFile=*/true,
+                                    /*F=*/nullptr, &Cache, FS);
+  }
+
+  static IntrusiveRefCntPtr<vfs::InMemoryFileSystem>
+  makeFS(ArrayRef<StringRef> Paths) {
+    auto FS = IntrusiveRefCntPtr<vfs::InMemoryFileSystem>(
+        new vfs::InMemoryFileSystem);
+    for (StringRef Path : Paths)
+      FS->addFile(Path, 0, MemoryBuffer::getMemBuffer("contents"));
+    return FS;
+  }
+
+  void overwriteCacheFile(StringRef Bytes) {
+    std::error_code EC;
+    raw_fd_ostream OS(CacheFile, EC);
+    ASSERT_FALSE(EC);
+    OS << Bytes;
+  }
+};
+
+TEST_F(PersistentStatCacheTest, RecordAndServeRoundTrip) {
+  vfs::Status Recorded;
+  {
+    // Warm-up run: the cache file does not exist, so results are recorded.
+    auto FS = makeFS({"/dir/a.h"});
+    auto Cache = PersistentStatCache::create(CacheFile);
+    EXPECT_FALSE(stat(*Cache, "/dir/a.h", Recorded, *FS));
+    vfs::Status S;
+    EXPECT_EQ(stat(*Cache, "/dir/missing.h", S, *FS),
+              std::make_error_code(std::errc::no_such_file_or_directory));
+  }
+  ASSERT_TRUE(sys::fs::exists(CacheFile));
+
+  // Later run: /dir/a.h is gone from the file system but is served from the
+  // cache, and the negative entry wins even though the path now exists.
+  auto FS = makeFS({"/dir/missing.h", "/dir/other.h"});
+  auto Cache = PersistentStatCache::create(CacheFile);
+  vfs::Status Served;
+  EXPECT_FALSE(stat(*Cache, "/dir/a.h", Served, *FS));
+  EXPECT_EQ(Served.getSize(), Recorded.getSize());
+  EXPECT_EQ(Served.getUniqueID(), Recorded.getUniqueID());
+  EXPECT_EQ(Served.getLastModificationTime(),
+            Recorded.getLastModificationTime());
+
+  vfs::Status S;
+  EXPECT_EQ(stat(*Cache, "/dir/missing.h", S, *FS),
+            std::make_error_code(std::errc::no_such_file_or_directory));
+
+  // Paths the cache has never seen fall through to the real file system.
+  EXPECT_FALSE(stat(*Cache, "/dir/other.h", S, *FS));
+}
+
+TEST_F(PersistentStatCacheTest, MalformedCacheIsRegenerated) {
+  overwriteCacheFile("not a stat cache at all");
+
+  {
+    // The garbage file is ignored; this run records a fresh cache.
+    auto FS = makeFS({"/dir/a.h"});
+    auto Cache = PersistentStatCache::create(CacheFile);
+    vfs::Status S;
+    EXPECT_FALSE(stat(*Cache, "/dir/a.h", S, *FS));
+  }
+
+  // The regenerated file serves entries even over an empty file system.
+  auto FS = makeFS({});
+  auto Cache = PersistentStatCache::create(CacheFile);
+  vfs::Status S;
+  EXPECT_FALSE(stat(*Cache, "/dir/a.h", S, *FS));
+}
+
+TEST_F(PersistentStatCacheTest, VersionMismatchIsRegenerated) {
+  // Valid magic, bogus version, zero entries.
+  SmallString<16> Header("CSTC");
+  Header.append({'\xff', '\xff', '\xff', '\xff'});
+  Header.append(8, '\0');
+  overwriteCacheFile(Header);
+
+  {
+    auto FS = makeFS({"/dir/a.h"});
+    auto Cache = PersistentStatCache::create(CacheFile);
+    vfs::Status S;
+    EXPECT_FALSE(stat(*Cache, "/dir/a.h", S, *FS));
+  }
+
+  auto FS = makeFS({});
+  auto Cache = PersistentStatCache::create(CacheFile);
+  vfs::Status S;
+  EXPECT_FALSE(stat(*Cache, "/dir/a.h", S, *FS));
+}
+
+TEST_F(PersistentStatCacheTest, TruncatedCacheIsRegenerated) {
+  // A well-formed header announcing more entries than the file holds.
+  SmallString<32> Data("CSTC");
+  Data.append({'\x01', '\0', '\0', '\0'}); // Version 1.
+  Data.append({'\x05', '\0', '\0', '\0', '\0', '\0', '\0', '\0'}); // 5 entries.
+  Data.append({'\x03', '\0'});                                     // PathLen 3.
+  overwriteCacheFile(Data);
+
+  auto FS = makeFS({"/dir/a.h"});
+  auto Cache = PersistentStatCache::create(CacheFile);
+  vfs::Status S;
+  // Falls through to the real file system: the cache is recording, not
+  // serving from the truncated file.
+  EXPECT_FALSE(stat(*Cache, "/dir/a.h", S, *FS));
+  EXPECT_EQ(stat(*Cache, "/dir/missing.h", S, *FS),
+            std::make_error_code(std::errc::no_such_file_or_directory));
+}
+
+} // namespace
@@ -94,6 +94,15 @@ StackDepotStats *StackDepotGetStats() {
   return theDepot.GetStats();
 }
 
+// Insertion is already sharded and lock-free in the common case: Put hashes
+// the whole trace up front (MurMur over the frame array), probes its bucket
+// without taking any lock, and only spins on the single bucket's tag bit
+// when a genuinely new trace must be linked in. With 2^kTabSizeLog buckets,
+// two threads contend only on a hash collision or when depositing identical
+// traces, so the depot is not where leak-report latency comes from; the slow
+// part of reporting is symbolization, which runs one frame at a time through
+// a single external symbolizer process (see sanitizer_symbolizer_libcdep.cpp)
+// and would need a batching protocol with that process to parallelize.
 u32 StackDepotPut(StackTrace stack) {
   StackDepotHandle h = theDepot.Put(stack);
   return h.valid() ? h.id() : 0;
@@ -84,6 +84,15 @@ public:
     unmap(reinterpret_cast<void *>(PrimaryBase), PrimarySize, UNMAP_ALL, &Data);
   }
 
+  // Contention notes: the mutex is per size class, and the front-end caches
+  // (local_cache.h) already move whole TransferBatches per acquisition, so a
+  // thread takes this lock once per batch of allocations, not per malloc.
+  // Threads piling onto the same class can still serialize here; before
+  // reaching for an rseq-style per-CPU layer (which ties the allocator to
+  // Linux with a careful fallback story, while this file also serves Fuchsia
+  // and tests), the supported levers are larger transfer batches and cache
+  // sizing via the size-class configuration, which raise the number of fast
+  // local allocations amortizing each lock acquisition.
   TransferBatch *popBatch(CacheT *C, uptr ClassId) {
     DCHECK_LT(ClassId, NumClasses);
     RegionInfo *Region = getRegionInfo(ClassId);
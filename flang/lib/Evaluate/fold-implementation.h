@@ -865,6 +865,18 @@ Expr<T> FromArrayConstructor(FoldingContext &context,
 // to each of their corresponding elements to produce a flat
 // ArrayConstructor<RESULT> (wrapped in an Expr<RESULT>).
 // Preserves shape.
+//
+// These loops will not fold at memory bandwidth, and that is a consequence of
+// what the elements are, not of the loop structure: Scalar<T> values are
+// software-emulated target arithmetic (value::Integer/value::Real of the
+// Fortran kind, with host-independent rounding and overflow detection feeding
+// per-operation diagnostics through the FoldingContext), wrapped back into
+// Expr nodes so the result is itself a foldable expression.  A flat kernel
+// over raw storage would need a host-arithmetic fast path per (operation,
+// kind) that still reproduces those semantics exactly — possible for the
+// kinds that match host types, but it belongs in the value:: layer where the
+// emulation lives, so every caller of Scalar arithmetic benefits, not only
+// these maps.
 
 // Unary case
 template <typename RESULT, typename OPERAND>
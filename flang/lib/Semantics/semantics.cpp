@@ -341,6 +341,15 @@ SourceName SemanticsContext::GetTempName(const Scope &scope) {
   return SaveTempName(".F18."s + std::to_string(tempNames_.size()));
 }
 
+// The phases below run sequentially over the whole program rather than
+// concurrently per program unit. That is load-bearing, not an oversight:
+// name resolution orders units through the global scope and module files
+// (a USE can only be resolved after the defining module's symbols exist),
+// all checkers share the SemanticsContext's FoldingContext, message buffer
+// and symbol arena, and the parse tree they rewrite is not confined to one
+// unit (generic resolution patches calls across units). Splitting the work
+// per unit requires first splitting that shared state, with a serial
+// resolution pass over module/submodule dependencies in front.
 bool Semantics::Perform() {
   return ValidateLabels(context_, program_) &&
       parser::CanonicalizeDo(program_) && // force line break
@@ -11,17 +11,49 @@
 
 #include "utils/CPP/Bitset.h"
 #include <stddef.h> // size_t
+#include <stdint.h> // uintptr_t
 
 namespace __llvm_libc {
 namespace internal {
 
+#ifdef LLVM_LIBC_UNSAFE_WIDE_READ
+// Reads the string a word at a time, using the carry trick to detect a zero
+// byte: (word - 0x01..01) & ~word & 0x80..80 is nonzero iff some byte of
+// word is zero. Aligned word loads never cross a page boundary, so the bytes
+// read past the terminator are always mapped, but they are outside the
+// string object, which is why this is gated behind an "unsafe" macro: the
+// out-of-bounds (if benign) loads are flagged by sanitizers.
+static inline size_t string_length_wide_read(const char *src) {
+  const char *char_ptr = src;
+  // Step bytewise until the pointer is word aligned.
+  for (; reinterpret_cast<uintptr_t>(char_ptr) % sizeof(uintptr_t) != 0;
+       ++char_ptr)
+    if (*char_ptr == '\0')
+      return char_ptr - src;
+  constexpr uintptr_t LOW_BITS = ~uintptr_t{0} / 0xff; // 0x01..01
+  constexpr uintptr_t HIGH_BITS = LOW_BITS << 7;       // 0x80..80
+  const uintptr_t *word_ptr = reinterpret_cast<const uintptr_t *>(char_ptr);
+  while (!((*word_ptr - LOW_BITS) & ~*word_ptr & HIGH_BITS))
+    ++word_ptr;
+  // The word holds the terminator; locate it bytewise.
+  for (char_ptr = reinterpret_cast<const char *>(word_ptr); *char_ptr;
+       ++char_ptr)
+    ;
+  return char_ptr - src;
+}
+#endif // LLVM_LIBC_UNSAFE_WIDE_READ
+
 // Returns the length of a string, denoted by the first occurrence
 // of a null terminator.
 static inline size_t string_length(const char *src) {
+#ifdef LLVM_LIBC_UNSAFE_WIDE_READ
+  return string_length_wide_read(src);
+#else
   size_t length;
   for (length = 0; *src; ++src, ++length)
     ;
   return length;
+#endif
 }
 
 // Returns the first occurrence of 'ch' within the first 'n' characters of
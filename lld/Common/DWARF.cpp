@@ -13,6 +13,13 @@ using namespace llvm;
 
 namespace lld {
 
+// The cache is deliberately eager across the CUs of one file but lazy across
+// files: nothing constructs a DWARFCache until the first query against that
+// object (a diagnostic, or .gdb_index creation, which builds caches from the
+// parallel executor), so links that emit no diagnostics parse no DWARF at
+// all. Deferring per CU inside the cache would not help beyond that - both
+// query kinds (variable locations by name, line info by section offset) have
+// no way to name their CU up front and must consult every unit anyway.
 DWARFCache::DWARFCache(std::unique_ptr<llvm::DWARFContext> d)
     : dwarf(std::move(d)) {
   for (std::unique_ptr<DWARFUnit> &cu : dwarf->compile_units()) {
@@ -94,6 +94,7 @@ bool elf::link(ArrayRef<const char *> args, bool canExitEarly,
     objectFiles.clear();
     sharedFiles.clear();
     backwardReferences.clear();
+    clearOwnedBuffers();
 
     tar = nullptr;
     memset(&in, 0, sizeof(in));
@@ -34,9 +34,12 @@
 //
 // 1. First, we partition sections using their hash values as keys. Hash
 //    values contain section types, section contents and numbers of
-//    relocations. During this step, relocation targets are not taken into
-//    account. We just put sections that apparently differ into different
-//    equivalence classes.
+//    relocations. The hashes are computed in parallel (xxHash64 over the
+//    section bytes, followed by two rounds that mix in the relocation
+//    shape), so this step pre-partitions sections cheaply before the more
+//    expensive pairwise refinement below. During this step, relocation
+//    targets are not taken into account. We just put sections that
+//    apparently differ into different equivalence classes.
 //
 // 2. Next, for each equivalence class, we visit sections to compare
 //    relocation targets. Relocation targets are considered equivalent if
@@ -52,6 +52,25 @@ std::vector<SharedFile *> elf::sharedFiles;
 
 std::unique_ptr<TarWriter> elf::tar;
 
+// Owners of the buffers returned by readFile, keyed by buffer start address,
+// so that a consumer can release the pages backing a MemoryBufferRef once it
+// is done with the contents.
+static DenseMap<const char *, MemoryBuffer *> ownedBuffers;
+
+// Release the physical pages backing mb if it came from a memory-mapped file.
+// The data stays accessible and is faulted back in from the file if touched
+// again; this just tells the OS we are done with it for now.
+void elf::dontNeedIfMmapped(MemoryBufferRef mb) {
+  if (MemoryBuffer *buffer = ownedBuffers.lookup(mb.getBufferStart()))
+    buffer->dontNeedIfMmapped();
+}
+
+// The buffers are arena-owned and freed between links, so the map must be
+// emptied with the other per-link globals or a second link in the same
+// process would look up dangling MemoryBuffer pointers (and mmap address
+// reuse can make such a lookup hit).
+void elf::clearOwnedBuffers() { ownedBuffers.clear(); }
+
 // Returns "<internal>", "foo.a(bar.o)" or "baz.o".
 std::string lld::toString(const InputFile *f) {
   if (!f)
@@ -123,6 +142,7 @@ Optional<MemoryBufferRef> elf::readFile(StringRef path) {
 
   std::unique_ptr<MemoryBuffer> &mb = *mbOrErr;
   MemoryBufferRef mbref = mb->getMemBufferRef();
+  ownedBuffers[mbref.getBufferStart()] = mb.get();
   make<std::unique_ptr<MemoryBuffer>>(std::move(mb)); // take MB ownership
 
   if (tar)
@@ -1086,6 +1106,11 @@ template <class ELFT> void ObjFile<ELFT>::initializeSymbols() {
   ArrayRef<Elf_Sym> eSyms = this->getELFSyms<ELFT>();
   this->symbols.resize(eSyms.size());
 
+  // Batch the hash table growth for this file's globals up front so the
+  // per-symbol insertions below never rehash mid-loop.
+  if (firstGlobal <= eSyms.size())
+    symtab->reserve(eSyms.size() - firstGlobal);
+
   // Fill in InputFile::symbols. Some entries have been initialized
   // because of LazyObjFile.
   for (size_t i = 0, end = eSyms.size(); i != end; ++i) {
@@ -1214,6 +1239,15 @@ void ArchiveFile::parse() {
 }
 
 // Returns a buffer pointing to a member file containing a given symbol.
+//
+// Members are fetched strictly on demand, and that is not an accident: which
+// members get pulled depends on the resolution state built up by the members
+// pulled before them, so a readahead of the whole symbol index would fault in
+// objects the link never loads - the usual case for big archives, where most
+// members stay untouched. For regular archives the member bytes live in the
+// already-mapped archive buffer and fetching is a pointer computation; only
+// thin archives open a file here, and those reads go through the same mmap
+// path the OS readahead already covers.
 void ArchiveFile::fetch(const Archive::Symbol &sym) {
   Archive::Child c =
       CHECK(sym.getMember(), toString(this) +
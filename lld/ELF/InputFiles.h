@@ -50,6 +50,14 @@ extern std::unique_ptr<llvm::TarWriter> tar;
 // Opens a given file.
 llvm::Optional<MemoryBufferRef> readFile(StringRef path);
 
+// Tells the OS that the pages backing a buffer returned by readFile are no
+// longer needed, if the buffer is memory-mapped.
+void dontNeedIfMmapped(MemoryBufferRef mb);
+
+// Drops the buffer-owner map behind dontNeedIfMmapped. Must be called
+// between links, when the arena that owns the buffers is freed.
+void clearOwnedBuffers();
+
 // Add symbols in File to the symbol table.
 void parseFile(InputFile *file);
 
@@ -143,6 +143,12 @@ size_t InputSectionBase::getSize() const {
   return rawData.size() - bytesDropped;
 }
 
+// Decompression is deliberately lazy: parsing only reads the compression
+// header, and this is called from data() on first access to the contents.
+// Sections that are dropped before anyone looks at them - GC'd, stripped, or
+// losers of ICF/merging - are therefore never decompressed, and sections that
+// survive to the output are decompressed directly into the output buffer in
+// writeTo() instead.
 void InputSectionBase::uncompress() const {
   size_t size = uncompressedSize;
   char *uncompressedBuf;
@@ -1361,6 +1367,14 @@ void MergeInputSection::splitStrings(ArrayRef<uint8_t> data, size_t entSize) {
   bool isAlloc = flags & SHF_ALLOC;
   StringRef s = toStringRef(data);
 
+  // Count the pieces up front so the vector is sized in one go. For the
+  // common single-byte case every NUL terminates exactly one string, and
+  // std::count compiles down to a vectorized scan, so this is much cheaper
+  // than growing the vector piecemeal on multi-million string .debug_str
+  // inputs.
+  if (entSize == 1)
+    pieces.reserve(std::count(s.begin(), s.end(), '\0'));
+
   while (!s.empty()) {
     size_t end = findNull(s, entSize);
     if (end == StringRef::npos)
@@ -1381,6 +1395,7 @@ void MergeInputSection::splitNonStrings(ArrayRef<uint8_t> data,
   assert((size % entSize) == 0);
   bool isAlloc = flags & SHF_ALLOC;
 
+  pieces.reserve(size / entSize);
   for (size_t i = 0; i != size; i += entSize)
     pieces.emplace_back(i, xxHash64(data.slice(i, entSize)), !isAlloc);
 }
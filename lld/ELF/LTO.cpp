@@ -315,6 +315,13 @@ std::vector<InputFile *> BitcodeCompiler::compile() {
         },
         cache));
 
+  // The bitcode inputs have been fully consumed. If they were memory-mapped,
+  // release the backing pages so a large LTO link does not keep every input
+  // resident until the very end. Symbol names may still point into the
+  // buffers and will be faulted back in from the files if touched.
+  for (BitcodeFile *f : bitcodeFiles)
+    dontNeedIfMmapped(f->mb);
+
   // Emit empty index files for non-indexed files but not in single-module mode.
   if (config->thinLTOModulesToCompile.empty()) {
     for (StringRef s : thinIndices) {
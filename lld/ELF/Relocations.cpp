@@ -1284,9 +1284,30 @@ static void processRelocAux(InputSectionBase &sec, RelExpr expr, RelType type,
               getLocation(sec, sym, offset));
 }
 
+namespace {
+// Everything scanReloc derives from a relocation before it starts creating
+// GOT/PLT entries and dynamic relocations. Splitting the scan at this
+// boundary is the first step towards scanning sections concurrently:
+// classification reads state that is fixed once symbol resolution finishes
+// (plus a couple of PPC64 per-file workaround flags that still need to move
+// to the action half), while the action half must stay serial so that
+// GOT/PLT slot and dynamic relocation assignment stays deterministic.
+struct RelocationInfo {
+  Symbol *sym;
+  RelType type;
+  RelExpr expr;
+  uint64_t offset;
+  int64_t addend;
+};
+} // namespace
+
+// Classify one relocation: resolve its symbol, type, output offset,
+// expression and addend, and report undefined symbol references. Advances
+// \p i past the record(s) consumed. Returns false if the relocation needs no
+// further action.
 template <class ELFT, class RelTy>
-static void scanReloc(InputSectionBase &sec, OffsetGetter &getOffset, RelTy *&i,
-                      RelTy *start, RelTy *end) {
+static bool classifyReloc(InputSectionBase &sec, OffsetGetter &getOffset,
+                          RelTy *&i, RelTy *end, RelocationInfo &info) {
   const RelTy &rel = *i;
   uint32_t symIndex = rel.getSymbol(config->isMips64EL);
   Symbol &sym = sec.getFile<ELFT>()->getSymbol(symIndex);
@@ -1303,19 +1324,19 @@ static void scanReloc(InputSectionBase &sec, OffsetGetter &getOffset, RelTy *&i,
   // Get an offset in an output section this relocation is applied to.
   uint64_t offset = getOffset.get(rel.r_offset);
   if (offset == uint64_t(-1))
-    return;
+    return false;
 
   // Error if the target symbol is undefined. Symbol index 0 may be used by
   // marker relocations, e.g. R_*_NONE and R_ARM_V4BX. Don't error on them.
   if (symIndex != 0 && maybeReportUndefined(sym, sec, rel.r_offset))
-    return;
+    return false;
 
   const uint8_t *relocatedAddr = sec.data().begin() + rel.r_offset;
   RelExpr expr = target->getRelExpr(type, sym, relocatedAddr);
 
   // Ignore R_*_NONE and other marker relocations.
   if (expr == R_NONE)
-    return;
+    return false;
 
   if (sym.isGnuIFunc() && !config->zText && config->warnIfuncTextrel) {
     warn("using ifunc symbols when text relocations are allowed may produce "
@@ -1354,7 +1375,7 @@ static void scanReloc(InputSectionBase &sec, OffsetGetter &getOffset, RelTy *&i,
         errorOrWarn("R_PPC64_TLSGD/R_PPC64_TLSLD may not be the last "
                     "relocation" +
                     getLocation(sec, sym, offset));
-        return;
+        return false;
       }
 
       // Offset the 4-byte aligned R_PPC64_TLSGD by one byte in the NOTOC case,
@@ -1390,6 +1411,23 @@ static void scanReloc(InputSectionBase &sec, OffsetGetter &getOffset, RelTy *&i,
     }
   }
 
+  info = {&sym, type, expr, offset, addend};
+  return true;
+}
+
+template <class ELFT, class RelTy>
+static void scanReloc(InputSectionBase &sec, OffsetGetter &getOffset, RelTy *&i,
+                      RelTy *start, RelTy *end) {
+  const RelTy &rel = *i;
+  RelocationInfo info;
+  if (!classifyReloc<ELFT>(sec, getOffset, i, end, info))
+    return;
+  Symbol &sym = *info.sym;
+  RelType type = info.type;
+  RelExpr expr = info.expr;
+  uint64_t offset = info.offset;
+  int64_t addend = info.addend;
+
   // If the relocation does not emit a GOT or GOTPLT entry but its computation
   // uses their addresses, we need GOT or GOTPLT to be created.
   //
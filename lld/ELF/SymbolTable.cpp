@@ -56,6 +56,15 @@ void SymbolTable::wrap(Symbol *sym, Symbol *real, Symbol *wrap) {
   real->isUsedInRegularObj = false;
 }
 
+// Pre-size the symbol table for a batch of `numGlobals` insertions. Called
+// once per input file before its resolution loop so that links with tens of
+// millions of symbol references grow the hash table at most once per file
+// instead of rehashing (and re-probing) repeatedly mid-batch.
+void SymbolTable::reserve(size_t numGlobals) {
+  symVector.reserve(symVector.size() + numGlobals);
+  symMap.reserve(symVector.capacity());
+}
+
 // Find an existing symbol or create a new one.
 Symbol *SymbolTable::insert(StringRef name) {
   // <name>@@<version> means the symbol is the default version. In that
@@ -45,6 +45,8 @@ public:
 
   void wrap(Symbol *sym, Symbol *real, Symbol *wrap);
 
+  void reserve(size_t numGlobals);
+
   Symbol *insert(StringRef name);
 
   Symbol *addSymbol(const Symbol &newSym);
@@ -2846,7 +2846,9 @@ createSymbols(ArrayRef<std::vector<GdbIndexSection::NameAttrEntry>> nameAttrs,
       ret.push_back(std::move(sym));
 
   // CU vectors and symbol names are adjacent in the output file.
-  // We can compute their offsets in the output file now.
+  // We can compute their offsets in the output file now. These loops are a
+  // running sum over the output layout, so unlike the merge above they are
+  // inherently sequential; they are also a tiny fraction of its cost.
   size_t off = 0;
   for (GdbSymbol &sym : ret) {
     sym.cuVectorOff = off;
@@ -42,6 +42,7 @@
 #include "llvm/ADT/Optional.h"
 #include "llvm/BinaryFormat/MachO.h"
 #include "llvm/Support/LEB128.h"
+#include "llvm/Support/Parallel.h"
 
 using namespace llvm;
 using namespace llvm::MachO;
@@ -239,8 +240,9 @@ size_t TrieBuilder::build() {
 }
 
 void TrieBuilder::writeTo(uint8_t *buf) const {
-  for (TrieNode *node : nodes)
-    node->writeTo(buf);
+  // Once build() has fixed the offsets, each node serializes into its own
+  // disjoint slice of the output, so the nodes can be written in parallel.
+  parallelForEach(nodes, [buf](TrieNode *node) { node->writeTo(buf); });
 }
 
 namespace {
@@ -112,9 +112,10 @@ void CodeSection::writeTo(uint8_t *buf) {
   // Write code section headers
   memcpy(buf, codeSectionHeader.data(), codeSectionHeader.size());
 
-  // Write code section bodies
-  for (const InputChunk *chunk : functions)
-    chunk->writeTo(buf);
+  // Write code section bodies. Each chunk writes (and relocates) only its own
+  // slice of the buffer, so emit them in parallel.
+  parallelForEach(functions,
+                  [buf](const InputChunk *chunk) { chunk->writeTo(buf); });
 }
 
 uint32_t CodeSection::getNumRelocations() const {
@@ -205,9 +206,10 @@ void DataSection::writeTo(uint8_t *buf) {
     uint8_t *segStart = buf + segment->sectionOffset;
     memcpy(segStart, segment->header.data(), segment->header.size());
 
-    // Write segment data payload
-    for (const InputChunk *chunk : segment->inputSegments)
-      chunk->writeTo(buf);
+    // Write segment data payload. Chunks cover disjoint ranges of the
+    // segment, so they can be written and relocated in parallel.
+    parallelForEach(segment->inputSegments,
+                    [buf](const InputChunk *chunk) { chunk->writeTo(buf); });
   }
 }
 
@@ -261,9 +263,10 @@ void CustomSection::writeTo(uint8_t *buf) {
   memcpy(buf, nameData.data(), nameData.size());
   buf += nameData.size();
 
-  // Write custom sections payload
-  for (const InputSection *section : inputSections)
-    section->writeTo(buf);
+  // Write custom sections payload in parallel; as above, each input section
+  // writes only its own range.
+  parallelForEach(inputSections,
+                  [buf](const InputSection *section) { section->writeTo(buf); });
 }
 
 uint32_t CustomSection::getNumRelocations() const {
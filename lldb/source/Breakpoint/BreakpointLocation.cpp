@@ -225,6 +225,16 @@ const char *BreakpointLocation::GetConditionText(size_t *hash) const {
       ->GetConditionText(hash);
 }
 
+// The compiled condition is cached on the location: the clang parse and JIT
+// only rerun when the condition text changes (hash check below) or when the
+// expression no longer matches the execution context. Repeated stops on a hot
+// breakpoint therefore pay for Materialize/Execute/Dematerialize, not for a
+// compiler instance. Widening this into a target-level cache keyed on
+// (expression text, frame type signature) is not sound as stated: parsing
+// binds identifiers through the frame's full symbol context — local shadowing,
+// anonymous namespaces, using-directives, and lexical block nesting all change
+// name lookup between frames whose variable types are identical — so equal
+// type signatures do not imply the same compiled code.
 bool BreakpointLocation::ConditionSaysStop(ExecutionContext &exe_ctx,
                                            Status &error) {
   Log *log = lldb_private::GetLogIfAllCategoriesSet(LIBLLDB_LOG_BREAKPOINTS);
@@ -382,6 +382,17 @@ void GDBRemoteCommunicationClient::GetRemoteQSupported() {
     // Look for a list of compressions in the features list e.g.
     // qXfer:features:read+;PacketSize=20000;qEcho+;SupportedCompressions=zlib-
     // deflate,lzma
+    //
+    // Latency notes for slow links: compression (negotiated right here) and
+    // the higher-level caches — the per-stop register context and the
+    // process MemoryCache — are the existing round-trip reducers; both
+    // invalidate on stop, so repeated reads within one stop are free. What
+    // the protocol itself cannot give us is speculation: packets are strictly
+    // request/response (a response is matched to the oldest outstanding
+    // request, and async notifications interleave), so "send the register
+    // reads along with the continue" needs a stub-side protocol extension,
+    // not just client pipelining — a stub that replies out of order or
+    // batches would break every existing consumer of this sequencing.
     const char *features_list = ::strstr(response_cstr, "qXfer:features:");
     if (features_list) {
       const char *compressions =
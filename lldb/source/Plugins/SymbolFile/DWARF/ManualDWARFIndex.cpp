@@ -21,6 +21,17 @@
 using namespace lldb_private;
 using namespace lldb;
 
+// Indexing fans out across the thread pool but still recomputes everything
+// from the raw DWARF on every debugger launch. Persisting the result is the
+// obvious next step; the constraints for whoever picks it up:
+// - The cache key must be the build ID (or a full content hash when absent);
+//   mtime/path keying silently serves stale indexes for rebuilt binaries.
+// - NameToDIE holds a ConstString map, and ConstString values are pointers
+//   into this process's global string pool, so the in-memory layout cannot
+//   be written out as-is; an mmap-friendly format needs offset-based string
+//   and DIERef tables with ConstString materialized lazily on lookup.
+// - Negative knowledge matters too: m_units_to_avoid (units covered by
+//   .debug_names) changes the set being indexed and must be part of the key.
 void ManualDWARFIndex::Index() {
   if (!m_dwarf)
     return;
@@ -9090,6 +9090,17 @@ clang::ClassTemplateDecl *TypeSystemClang::ParseClassTemplateDecl(
   return nullptr;
 }
 
+// Types start life as forward declarations and are only filled in when clang
+// asks for them through this external-AST-source callback, so laziness across
+// types already exists. The expensive case is the completion of one type
+// being transitively deep: CompleteType parses all members, and a member of
+// class type needs at least a forward declaration whose eventual completion
+// pulls in its own members, and so on up template-heavy hierarchies. The
+// completion itself cannot be depth-bounded here — once clang asks, it needs
+// a genuinely complete definition (layout, bases, vtable) and a partial one
+// would miscompile expressions. Shallow "display only" type views are a
+// ValueObject/data-formatter policy decision about *which* types to ask
+// clang to complete, not something this callback can fake.
 void TypeSystemClang::CompleteTagDecl(clang::TagDecl *decl) {
   SymbolFile *sym_file = GetSymbolFile();
   if (sym_file) {
@@ -0,0 +1,78 @@
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
+
+// Microbenchmarks for the containers that dominate compiler heap profiles.
+// Key sets use a multiplicative hash of the index so insertion order is
+// deterministic but not contiguous.
+
+static inline uint64_t scramble(uint64_t I) {
+  return I * 0x9E3779B97F4A7C15ULL;
+}
+
+static void BM_DenseMapInsert(benchmark::State &State) {
+  unsigned N = State.range(0);
+  for (auto _ : State) {
+    llvm::DenseMap<uint64_t, uint64_t> Map;
+    for (unsigned I = 0; I < N; ++I)
+      Map[scramble(I)] = I;
+    benchmark::DoNotOptimize(Map);
+  }
+}
+BENCHMARK(BM_DenseMapInsert)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void BM_DenseMapInsertReserved(benchmark::State &State) {
+  unsigned N = State.range(0);
+  for (auto _ : State) {
+    llvm::DenseMap<uint64_t, uint64_t> Map;
+    Map.reserve(N);
+    for (unsigned I = 0; I < N; ++I)
+      Map[scramble(I)] = I;
+    benchmark::DoNotOptimize(Map);
+  }
+}
+BENCHMARK(BM_DenseMapInsertReserved)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void BM_DenseMapLookup(benchmark::State &State) {
+  unsigned N = State.range(0);
+  llvm::DenseMap<uint64_t, uint64_t> Map;
+  for (unsigned I = 0; I < N; ++I)
+    Map[scramble(I)] = I;
+  for (auto _ : State) {
+    uint64_t Sum = 0;
+    for (unsigned I = 0; I < N; ++I)
+      Sum += Map.lookup(scramble(I));
+    benchmark::DoNotOptimize(Sum);
+  }
+}
+BENCHMARK(BM_DenseMapLookup)->Arg(16)->Arg(1024)->Arg(65536);
+
+static void BM_SmallVectorPushBack(benchmark::State &State) {
+  unsigned N = State.range(0);
+  for (auto _ : State) {
+    llvm::SmallVector<uint64_t, 8> Vec;
+    for (unsigned I = 0; I < N; ++I)
+      Vec.push_back(I);
+    benchmark::DoNotOptimize(Vec);
+  }
+}
+BENCHMARK(BM_SmallVectorPushBack)->Arg(8)->Arg(1024)->Arg(65536);
+
+static void BM_StringMapInsert(benchmark::State &State) {
+  unsigned N = State.range(0);
+  // Build the key spellings outside the timed region.
+  std::vector<std::string> Keys;
+  Keys.reserve(N);
+  for (unsigned I = 0; I < N; ++I)
+    Keys.push_back("key." + std::to_string(scramble(I)));
+  for (auto _ : State) {
+    llvm::StringMap<uint64_t> Map;
+    for (unsigned I = 0; I < N; ++I)
+      Map[Keys[I]] = I;
+    benchmark::DoNotOptimize(Map);
+  }
+}
+BENCHMARK(BM_StringMapInsert)->Arg(16)->Arg(1024)->Arg(65536);
+
+BENCHMARK_MAIN();
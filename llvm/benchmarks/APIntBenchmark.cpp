@@ -0,0 +1,50 @@
+#include "benchmark/benchmark.h"
+#include "llvm/ADT/APInt.h"
+
+using llvm::APInt;
+
+// Covers the limb loops that dominate constant folding of wide-integer IR:
+// multiply (tcMultiplyPart), divide/remainder (KnuthDiv), and addition.
+// Widths are chosen to hit the single-word fast path (64), a handful of limbs
+// (256/512), and a clearly multi-limb case (4096).
+
+static APInt makeOperand(unsigned Bits, uint64_t Seed) {
+  APInt X(Bits, Seed);
+  // Spread non-zero bits over all limbs so the loops do real work.
+  for (unsigned I = 64; I < Bits; I += 64)
+    X |= APInt(Bits, Seed * (I + 1)).shl(I);
+  return X;
+}
+
+static void BM_APIntMultiply(benchmark::State &State) {
+  unsigned Bits = State.range(0);
+  APInt A = makeOperand(Bits, 0x9E3779B97F4A7C15ULL);
+  APInt B = makeOperand(Bits, 0xC2B2AE3D27D4EB4FULL);
+  for (auto _ : State)
+    benchmark::DoNotOptimize(A * B);
+}
+BENCHMARK(BM_APIntMultiply)->Arg(64)->Arg(256)->Arg(512)->Arg(4096);
+
+static void BM_APIntUDivRem(benchmark::State &State) {
+  unsigned Bits = State.range(0);
+  APInt A = makeOperand(Bits, 0x9E3779B97F4A7C15ULL);
+  APInt B = makeOperand(Bits / 2, 0xC2B2AE3D27D4EB4FULL).zext(Bits);
+  APInt Quotient(Bits, 0), Remainder(Bits, 0);
+  for (auto _ : State) {
+    APInt::udivrem(A, B, Quotient, Remainder);
+    benchmark::DoNotOptimize(Quotient);
+    benchmark::DoNotOptimize(Remainder);
+  }
+}
+BENCHMARK(BM_APIntUDivRem)->Arg(64)->Arg(256)->Arg(512)->Arg(4096);
+
+static void BM_APIntAdd(benchmark::State &State) {
+  unsigned Bits = State.range(0);
+  APInt A = makeOperand(Bits, 0x9E3779B97F4A7C15ULL);
+  APInt B = makeOperand(Bits, 0xC2B2AE3D27D4EB4FULL);
+  for (auto _ : State)
+    benchmark::DoNotOptimize(A + B);
+}
+BENCHMARK(BM_APIntAdd)->Arg(64)->Arg(256)->Arg(512)->Arg(4096);
+
+BENCHMARK_MAIN();
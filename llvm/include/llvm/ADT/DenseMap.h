@@ -570,6 +570,12 @@ private:
     // the buckets are empty (meaning that many are filled with tombstones),
     // grow the table.
     //
+    // Growing rehashes every entry at once. Incremental schemes (e.g. an
+    // extendible-hashing directory of segments) would bound the pause, but
+    // they add an indirection to every lookup, which is the wrong trade for
+    // this map. Callers that can estimate their final size should reserve()
+    // up front instead.
+    //
     // The later case is tricky.  For example, if we had one empty bucket with
     // tons of tombstones, failing lookups (e.g. for insertion) would have to
     // probe almost the entire table until it found the empty bucket.  If the
@@ -441,6 +441,12 @@ public:
   /// SelectionDAG ready to process a new block.
   void clear();
 
+  /// Pre-size the CSE map for a DAG expected to grow to around \p NumNodes
+  /// nodes. Growing the map organically rehashes at every doubling, and each
+  /// rehash re-profiles every node already inserted, which is a noticeable
+  /// cost when building very large blocks. Never shrinks the map.
+  void reserveCSEMap(unsigned NumNodes) { CSEMap.reserve(NumNodes); }
+
   MachineFunction &getMachineFunction() const { return *MF; }
   const Pass *getPass() const { return SDAGISelPass; }
 
@@ -225,7 +225,8 @@ class DIContext {
 public:
   enum DIContextKind {
     CK_DWARF,
-    CK_PDB
+    CK_PDB,
+    CK_GSYM
   };
 
   DIContext(DIContextKind K) : Kind(K) {}
@@ -177,6 +177,15 @@ public:
     return unit_iterator_range(NormalUnits.begin(), NormalUnits.end());
   }
 
+  /// Eagerly extract the DIEs of every normal unit, using all available
+  /// hardware threads. Units are extracted independently, so clients that
+  /// know they will visit most of the debug info (dumping, verifying,
+  /// symbolizing many addresses in a large binary) can use this to avoid
+  /// decoding each unit's DIEs serially on first touch. The context's error
+  /// and warning handlers may be invoked from multiple threads concurrently
+  /// and must be thread-safe. No-op for units whose DIEs are already parsed.
+  void extractUnitDIEsInParallel();
+
   /// Get units from .debug_info..dwo in the DWO context.
   unit_iterator_range dwo_info_section_units() {
     parseDWOUnits();
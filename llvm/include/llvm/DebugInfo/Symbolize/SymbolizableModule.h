@@ -42,6 +42,11 @@ public:
   // Returns the preferred base of the module, i.e. where the loader would place
   // it in memory assuming there were no conflicts.
   virtual uint64_t getModulePreferredBase() const = 0;
+
+  // Returns the debug info context backing this module, if the implementation
+  // exposes one. Callers may use it to prepare the context for a known query
+  // pattern (e.g. eagerly parsing before a large batch of lookups).
+  virtual DIContext *getDIContext() const { return nullptr; }
 };
 
 } // end namespace symbolize
@@ -44,11 +44,16 @@ public:
     bool RelativeAddresses = false;
     bool UntagAddresses = false;
     bool UseDIA = false;
+    /// Use a GSYM sidecar file (see lookUpGsymFile) instead of DWARF when one
+    /// is found. GSYM files are mmapped read-only, so repeated symbolization
+    /// of the same binary across processes avoids re-parsing its debug info.
+    bool UseGsym = false;
     std::string DefaultArch;
     std::vector<std::string> DsymHints;
     std::string FallbackDebugPath;
     std::string DWPName;
     std::vector<std::string> DebugFileDirectory;
+    std::vector<std::string> GsymFileDirectory;
   };
 
   LLVMSymbolizer() = default;
@@ -62,6 +67,15 @@ public:
                                      object::SectionedAddress ModuleOffset);
   Expected<DILineInfo> symbolizeCode(const std::string &ModuleName,
                                      object::SectionedAddress ModuleOffset);
+  /// Symbolize a batch of addresses within one module. Equivalent to calling
+  /// symbolizeCode for each address, but visits the addresses in ascending
+  /// order so that every query hitting the same compile unit is resolved
+  /// while its decoded line table is hot, and large batches decode the DIEs
+  /// of all units in parallel up front. Results are returned in the order of
+  /// \p Addresses.
+  Expected<std::vector<DILineInfo>>
+  symbolizeAddresses(const std::string &ModuleName,
+                     ArrayRef<uint64_t> Addresses);
   Expected<DIInliningInfo>
   symbolizeInlinedCode(const std::string &ModuleName,
                        object::SectionedAddress ModuleOffset);
@@ -97,6 +111,11 @@ private:
                    std::unique_ptr<DIContext> Context,
                    StringRef ModuleName);
 
+  /// Returns a GSYM-backed DIContext for \p Path if Opts.UseGsym is set and a
+  /// sidecar file is found in Opts.GsymFileDirectory or next to the binary
+  /// ("<Path>.gsym"), or nullptr to fall back to DWARF.
+  std::unique_ptr<DIContext> lookUpGsymFile(const std::string &Path);
+
   ObjectFile *lookUpDsymFile(const std::string &Path,
                              const MachOObjectFile *ExeObj,
                              const std::string &ArchName);
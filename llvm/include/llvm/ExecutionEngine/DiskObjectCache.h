@@ -0,0 +1,65 @@
+//===- DiskObjectCache.h - Disk-backed, shareable object cache --*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// An ObjectCache implementation backed by a directory on disk that can be
+// shared by any number of concurrent processes.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_EXECUTIONENGINE_DISKOBJECTCACHE_H
+#define LLVM_EXECUTIONENGINE_DISKOBJECTCACHE_H
+
+#include "llvm/ExecutionEngine/ObjectCache.h"
+#include "llvm/Support/Error.h"
+#include <string>
+
+namespace llvm {
+
+/// A disk-backed ObjectCache that can be shared by any number of processes.
+///
+/// Entries are content-addressed: the key is a hash of the module's IR
+/// together with a client-supplied target fingerprint, so a stale or
+/// mismatched entry can never be returned. Hits are returned as memory-mapped
+/// buffers, so identical objects loaded by many processes share physical
+/// pages. Writes go through a unique temporary file followed by an atomic
+/// rename, so concurrent processes may race to populate the same entry and
+/// the loser simply overwrites the winner with identical bytes.
+///
+/// The cache is best-effort: I/O errors while writing an entry are ignored
+/// and merely result in a future cache miss.
+class DiskObjectCache : public ObjectCache {
+public:
+  /// Create a cache rooted at \p CacheDir, creating the directory if
+  /// necessary.
+  ///
+  /// \p TargetFingerprint should identify everything that affects code
+  /// generation besides the module itself: at least the target triple, CPU,
+  /// feature string and optimization level. It is mixed into every entry's
+  /// key, so processes with different codegen settings can safely share one
+  /// cache directory.
+  static Expected<std::unique_ptr<DiskObjectCache>>
+  Create(StringRef CacheDir, StringRef TargetFingerprint);
+
+  void notifyObjectCompiled(const Module *M, MemoryBufferRef Obj) override;
+  std::unique_ptr<MemoryBuffer> getObject(const Module *M) override;
+
+private:
+  DiskObjectCache(std::string CacheDir, std::string TargetFingerprint)
+      : CacheDir(std::move(CacheDir)),
+        TargetFingerprint(std::move(TargetFingerprint)) {}
+
+  /// Returns the path of the entry for \p M.
+  std::string getEntryPath(const Module &M);
+
+  std::string CacheDir;
+  std::string TargetFingerprint;
+};
+
+} // end namespace llvm
+
+#endif // LLVM_EXECUTIONENGINE_DISKOBJECTCACHE_H
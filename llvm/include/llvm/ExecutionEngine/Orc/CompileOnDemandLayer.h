@@ -73,6 +73,12 @@ public:
   using PartitionFunction =
       std::function<Optional<GlobalValueSet>(GlobalValueSet Requested)>;
 
+  /// Notification function for symbols whose definitions are about to be
+  /// extracted and compiled. JD is the implementation dylib that this layer
+  /// created for the target dylib (named "<target>.impl").
+  using NotifyMaterializingFunction =
+      std::function<void(JITDylib &JD, const SymbolNameSet &Requested)>;
+
   /// Off-the-shelf partitioning which compiles all requested symbols (usually
   /// a single function at a time).
   static Optional<GlobalValueSet> compileRequested(GlobalValueSet Requested);
@@ -92,6 +98,20 @@ public:
   /// Sets the ImplSymbolMap
   void setImplMap(ImplSymbolMap *Imp);
 
+  /// Sets a function to be called with the requested symbols each time a
+  /// partition is about to be compiled. Together with prematerialize this can
+  /// be used to record a warm-up profile: write the names out during one run
+  /// and replay them at the start of the next.
+  void setNotifyMaterializing(NotifyMaterializingFunction NotifyMaterializing);
+
+  /// Trigger compilation of the given symbols' definitions as if their stubs
+  /// had been called, without waiting for the result. Compilation runs on the
+  /// ExecutionSession's materialization dispatcher, so with a multi-threaded
+  /// dispatcher a recorded profile can be warmed up in the background before
+  /// the first request arrives. Unknown symbols are ignored, so a profile
+  /// remains usable after the program's code has changed.
+  void prematerialize(JITDylib &TargetD, SymbolNameSet Symbols);
+
   /// Emits the given module. This should not be called by clients: it will be
   /// called by the JIT when a definition added via the add method is requested.
   void emit(std::unique_ptr<MaterializationResponsibility> R,
@@ -132,6 +152,7 @@ private:
   PartitionFunction Partition = compileRequested;
   SymbolLinkagePromoter PromoteSymbols;
   ImplSymbolMap *AliaseeImpls = nullptr;
+  NotifyMaterializingFunction NotifyMaterializing;
 };
 
 } // end namespace orc
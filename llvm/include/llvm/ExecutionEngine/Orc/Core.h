@@ -651,6 +651,14 @@ public:
   /// output.
   virtual StringRef getName() const = 0;
 
+  /// Returns true if materializing this unit involves significant work (e.g.
+  /// compiling IR or linking an object), in which case dispatchers with
+  /// worker threads should prefer to run it on one of them. Units that only
+  /// manipulate the symbol table (absolute symbols, reexports, lazy-reexport
+  /// stubs) override this to return false: queueing them behind in-flight
+  /// compiles would delay resolution of symbols that are cheap to provide.
+  virtual bool isExpensiveToMaterialize() const { return true; }
+
   /// Return the set of symbols that this source provides.
   const SymbolFlagsMap &getSymbols() const { return SymbolFlags; }
 
@@ -693,6 +701,7 @@ public:
   AbsoluteSymbolsMaterializationUnit(SymbolMap Symbols);
 
   StringRef getName() const override;
+  bool isExpensiveToMaterialize() const override { return false; }
 
 private:
   void materialize(std::unique_ptr<MaterializationResponsibility> R) override;
@@ -735,6 +744,7 @@ public:
                                SymbolAliasMap Aliases);
 
   StringRef getName() const override;
+  bool isExpensiveToMaterialize() const override { return false; }
 
 private:
   void materialize(std::unique_ptr<MaterializationResponsibility> R) override;
@@ -231,6 +231,15 @@ public:
   /// Returns a reference to the on-demand layer.
   CompileOnDemandLayer &getCompileOnDemandLayer() { return *CODLayer; }
 
+  /// Eagerly compile the given symbols' definitions without waiting for the
+  /// result, as if their stubs had been called. Names should be mangled, e.g.
+  /// as recorded via CompileOnDemandLayer::setNotifyMaterializing in an
+  /// earlier run; unknown names are ignored. With a multi-threaded dispatcher
+  /// this warms the JIT up in the background before the first request.
+  void prewarm(JITDylib &JD, SymbolNameSet Symbols) {
+    CODLayer->prematerialize(JD, std::move(Symbols));
+  }
+
   /// Add a module to be lazily compiled to JITDylib JD.
   Error addLazyIRModule(JITDylib &JD, ThreadSafeModule M);
 
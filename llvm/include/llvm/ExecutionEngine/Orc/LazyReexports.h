@@ -147,6 +147,7 @@ public:
                                    ImplSymbolMap *SrcJDLoc);
 
   StringRef getName() const override;
+  bool isExpensiveToMaterialize() const override { return false; }
 
 private:
   void materialize(std::unique_ptr<MaterializationResponsibility> R) override;
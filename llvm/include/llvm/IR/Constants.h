@@ -43,6 +43,12 @@ namespace llvm {
 
 template <class ConstantClass> struct ConstantAggrKeyType;
 
+class MallocAllocator;
+template <typename AllocatorT, size_t SlabSize, size_t SizeThreshold,
+          size_t GrowthDelay>
+class BumpPtrAllocatorImpl;
+using BumpPtrAllocator = BumpPtrAllocatorImpl<MallocAllocator, 4096, 4096, 128>;
+
 /// Base class for constants with no operands.
 ///
 /// These constants have no operands; they represent their data directly.
@@ -60,6 +66,14 @@ protected:
 
   void *operator new(size_t s) { return User::operator new(s, 0); }
 
+  /// Arena form used for uniqued constants owned by LLVMContextImpl that live
+  /// as long as the context itself. The storage is carved out of the
+  /// context's bump allocator and reclaimed wholesale with it, so there is no
+  /// per-node operator delete; destructors still run so that out-of-line
+  /// APInt/APFloat storage is freed.
+  void *operator new(size_t S, BumpPtrAllocator &Alloc);
+  void operator delete(void *, BumpPtrAllocator &) {}
+
 public:
   ConstantData(const ConstantData &) = delete;
 
@@ -23,6 +23,8 @@
 
 namespace llvm {
 
+class Constant;
+class DataLayout;
 class DiagnosticInfo;
 enum DiagnosticSeverity : char;
 class Function;
@@ -146,6 +148,19 @@ public:
   /// especially in release mode.
   void setDiscardValueNames(bool Discard);
 
+  /// Look up a memoized constant folding result for \p C computed under the
+  /// data layout \p DL, or return null if none is cached. Constants are
+  /// uniqued in the context, so a cache hit means the same expression tree
+  /// was folded before. Querying with a different data layout than the cache
+  /// was filled under discards the cached results.
+  Constant *getCachedConstantFold(const Constant *C, const DataLayout &DL);
+
+  /// Memoize that \p C folds to \p Folded. Must follow a failed
+  /// getCachedConstantFold query with the same data layout. The cache is
+  /// dropped whenever a constant is destroyed, since both keys and values
+  /// would otherwise dangle.
+  void addCachedConstantFold(const Constant *C, Constant *Folded);
+
   /// Whether there is a string map for uniquing debug info
   /// identifiers across the context.  Off by default.
   bool isODRUniquingDebugTypes() const;
@@ -152,14 +152,54 @@ struct alignas(8) GlobalValueSummaryInfo {
   GlobalValueSummaryList SummaryList;
 };
 
+/// A minimal STL-compatible allocator that carves map nodes out of a
+/// BumpPtrAllocator owned by the index. The global value map is built once
+/// (during analysis or bitcode reading) and torn down wholesale with the
+/// index, so per-node deallocation can be a no-op. On large combined indexes
+/// this removes one malloc and its bookkeeping overhead per GUID and keeps
+/// the nodes contiguous, which is a significant slice of thin-link RSS.
+template <typename T> class SummaryMapAllocator {
+  BumpPtrAllocator *Alloc;
+
+  template <typename U> friend class SummaryMapAllocator;
+
+public:
+  using value_type = T;
+
+  SummaryMapAllocator(BumpPtrAllocator &Alloc) : Alloc(&Alloc) {}
+  template <typename U>
+  SummaryMapAllocator(const SummaryMapAllocator<U> &Other)
+      : Alloc(Other.Alloc) {}
+
+  T *allocate(size_t N) {
+    return static_cast<T *>(Alloc->Allocate(N * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *, size_t) {
+    // Nodes live as long as the index; the arena is freed wholesale.
+  }
+
+  friend bool operator==(const SummaryMapAllocator &LHS,
+                         const SummaryMapAllocator &RHS) {
+    return LHS.Alloc == RHS.Alloc;
+  }
+  friend bool operator!=(const SummaryMapAllocator &LHS,
+                         const SummaryMapAllocator &RHS) {
+    return !(LHS == RHS);
+  }
+};
+
 /// Map from global value GUID to corresponding summary structures. Use a
 /// std::map rather than a DenseMap so that pointers to the map's value_type
 /// (which are used by ValueInfo) are not invalidated by insertion. Also it will
 /// likely incur less overhead, as the value type is not very small and the size
 /// of the map is unknown, resulting in inefficiencies due to repeated
-/// insertions and resizing.
+/// insertions and resizing. Nodes are bump-allocated from the index's arena,
+/// see SummaryMapAllocator.
 using GlobalValueSummaryMapTy =
-    std::map<GlobalValue::GUID, GlobalValueSummaryInfo>;
+    std::map<GlobalValue::GUID, GlobalValueSummaryInfo,
+             std::less<GlobalValue::GUID>,
+             SummaryMapAllocator<
+                 std::pair<const GlobalValue::GUID, GlobalValueSummaryInfo>>>;
 
 /// Struct that holds a reference to a particular GUID in a global value
 /// summary.
@@ -494,6 +534,14 @@ public:
   /// <CalleeValueInfo, CalleeInfo> call edge pair.
   using EdgeTy = std::pair<ValueInfo, CalleeInfo>;
 
+  // Note on scope: summaries carry what the thin link needs for import and
+  // liveness decisions plus the attribute-style facts below; they do not
+  // carry per-argument constant lattices. Summary-based IPSCCP would need
+  // per-call-site argument values recorded at build time, a propagation pass
+  // in the thin link, and a way for backends to clone specialized bodies -
+  // each a format-breaking extension (bitcode reader/writer, combined-index
+  // serialization) that has to be introduced together, not piecemeal.
+
   /// Types for -force-summary-edges-cold debugging option.
   enum ForceSummaryHotnessType : unsigned {
     FSHT_None,
@@ -1005,6 +1053,13 @@ using TypeIdCompatibleVtableInfo = std::vector<TypeIdOffsetVtableInfo>;
 /// and encapsulate methods for operating on them.
 class ModuleSummaryIndex {
 private:
+  // Used in cases where we want to record the name of a global, but
+  // don't have the string owned elsewhere (e.g. the Strtab on a module).
+  // Also backs the GlobalValueMap node allocations, so it must be declared
+  // before the map.
+  BumpPtrAllocator Alloc;
+  StringSaver Saver;
+
   /// Map from value name to list of summary instances for values of that
   /// name (may be duplicates in the COMDAT case, e.g.).
   GlobalValueSummaryMapTy GlobalValueMap;
@@ -1066,11 +1121,6 @@ private:
   std::set<std::string> CfiFunctionDefs;
   std::set<std::string> CfiFunctionDecls;
 
-  // Used in cases where we want to record the name of a global, but
-  // don't have the string owned elsewhere (e.g. the Strtab on a module).
-  StringSaver Saver;
-  BumpPtrAllocator Alloc;
-
   // The total number of basic blocks in the module in the per-module summary or
   // the total number of basic blocks in the LTO unit in the combined index.
   uint64_t BlockCount;
@@ -1087,7 +1137,10 @@ private:
 public:
   // See HaveGVs variable comment.
   ModuleSummaryIndex(bool HaveGVs, bool EnableSplitLTOUnit = false)
-      : HaveGVs(HaveGVs), EnableSplitLTOUnit(EnableSplitLTOUnit), Saver(Alloc),
+      : Saver(Alloc),
+        GlobalValueMap(GlobalValueSummaryMapTy::key_compare(),
+                       GlobalValueSummaryMapTy::allocator_type(Alloc)),
+        HaveGVs(HaveGVs), EnableSplitLTOUnit(EnableSplitLTOUnit),
         BlockCount(0) {}
 
   // Current version for the module summary in bitcode files.
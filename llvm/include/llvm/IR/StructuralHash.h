@@ -14,21 +14,19 @@
 #ifndef LLVM_IR_STRUCTURALHASH_H
 #define LLVM_IR_STRUCTURALHASH_H
 
-#ifdef EXPENSIVE_CHECKS
-
 #include <cstdint>
 
-// This header is only meant to be used when -DEXPENSIVE_CHECKS is set
 namespace llvm {
 
 class Function;
 class Module;
 
+// The hash covers instruction opcodes and the shape of the control flow only;
+// it deliberately ignores operands, so two functions that differ only in the
+// values they compute with may hash equal.
 uint64_t StructuralHash(const Function &F);
 uint64_t StructuralHash(const Module &M);
 
 } // end namespace llvm
 
-#endif
-
 #endif // LLVM_IR_STRUCTURALHASH_H
@@ -182,13 +182,14 @@ private:
   bool fragmentNeedsRelaxation(const MCRelaxableFragment *IF,
                                const MCAsmLayout &Layout) const;
 
-  /// Perform one layout iteration and return true if any offsets
-  /// were adjusted.
-  bool layoutOnce(MCAsmLayout &Layout);
-
-  /// Perform one layout iteration of the given section and return true
-  /// if any offsets were adjusted.
-  bool layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec);
+  /// Perform one layout iteration over the per-section lists of fragments
+  /// that can change size, and return true if any offsets were adjusted.
+  bool layoutOnce(MCAsmLayout &Layout,
+                  ArrayRef<SmallVector<MCFragment *, 0>> RelaxableFrags);
+
+  /// Perform one layout iteration over one section's relaxable fragments
+  /// (given in section order) and return true if any offsets were adjusted.
+  bool layoutSectionOnce(MCAsmLayout &Layout, ArrayRef<MCFragment *> Frags);
 
   /// Perform relaxation on a single fragment - returns true if the fragment
   /// changes as a result of relaxation.
@@ -123,6 +123,18 @@ public:
   ///                   MCDisassembler::SoftFail if the instruction was
   ///                                            disassemblable but invalid,
   ///                   MCDisassembler::Fail if the instruction was invalid.
+  ///
+  /// This one-instruction-per-call interface is the right granularity even
+  /// for bulk consumers, and a batch "decode this region into an arena"
+  /// entry point would not change what dominates decode time. The caller
+  /// must intervene between instructions anyway — the next decode address
+  /// depends on the returned Size, and callers like llvm-objdump consult
+  /// symbols, data-in-code regions and mapping symbols per instruction. The
+  /// per-call costs worth attacking are real but live elsewhere: reusing one
+  /// MCInst across calls (clear() keeps operand capacity, so the "vector
+  /// churn" is first-call only) and the generated decoder's table walk,
+  /// where a first-byte dispatch fast path would be a FixedLenDecoderEmitter
+  /// change benefiting every target uniformly rather than a new API here.
   virtual DecodeStatus getInstruction(MCInst &Instr, uint64_t &Size,
                                       ArrayRef<uint8_t> Bytes, uint64_t Address,
                                       raw_ostream &CStream) const = 0;
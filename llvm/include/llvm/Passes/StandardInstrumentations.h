@@ -24,6 +24,7 @@
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Transforms/IPO/SampleProfileProbe.h"
 
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -79,6 +80,58 @@ public:
   void registerCallbacks(PassInstrumentationCallbacks &PIC);
 };
 
+/// Instrumentation that skips function passes expected to be no-ops.
+///
+/// For each (pass, function) pair this remembers the structural hash the
+/// function had the last time the pass ran on it without making changes. When
+/// the same pass reaches a function that still hashes to that value, the run
+/// is skipped. The hash covers opcodes and control flow only and a pass may
+/// read state beyond the function body, so a skipped run is not guaranteed to
+/// have been a no-op; the cache is opt-in via -skip-unchanged-function-passes.
+class SkipUnchangedInstrumentation {
+public:
+  SkipUnchangedInstrumentation(bool DebugLogging)
+      : DebugLogging(DebugLogging) {}
+  void registerCallbacks(PassInstrumentationCallbacks &PIC);
+
+private:
+  bool shouldRun(StringRef PassID, Any IR);
+
+  /// Drops every cached hash for \p F. Called when F is deleted, so that a
+  /// function later allocated at the same address cannot inherit its entries.
+  void functionDeleted(Value *F);
+
+  /// Value handle that prunes a function's cached hashes when it dies.
+  class FunctionWatcher final : public CallbackVH {
+    SkipUnchangedInstrumentation *Parent;
+
+    void deleted() override {
+      Parent->functionDeleted(getValPtr());
+      CallbackVH::deleted();
+    }
+
+  public:
+    FunctionWatcher(SkipUnchangedInstrumentation *Parent, Value *V)
+        : CallbackVH(V), Parent(Parent) {}
+  };
+
+  /// Structural hash each function had the last time a given pass made no
+  /// changes to it.
+  DenseMap<std::pair<StringRef, const Function *>, uint64_t> NoChangeHash;
+
+  /// One watcher per function with entries in NoChangeHash. An entry whose
+  /// handle has been nulled by deletion is re-armed if its address is reused.
+  DenseMap<const Function *, std::unique_ptr<FunctionWatcher>> Watchers;
+
+  /// Passes currently in flight, innermost last. The hash is taken on entry
+  /// for function passes and is None for other IR units.
+  SmallVector<
+      std::pair<StringRef, Optional<std::pair<const Function *, uint64_t>>>, 8>
+      HashStackBefore;
+
+  bool DebugLogging;
+};
+
 // Debug logging for transformation and analysis passes.
 class PrintPassInstrumentation {
 public:
@@ -272,6 +325,7 @@ class StandardInstrumentations {
   TimePassesHandler TimePasses;
   OptNoneInstrumentation OptNone;
   OptBisectInstrumentation OptBisect;
+  SkipUnchangedInstrumentation SkipUnchanged;
   PreservedCFGCheckerInstrumentation PreservedCFGChecker;
   IRChangedPrinter PrintChangedIR;
   PseudoProbeVerifier PseudoProbeVerification;
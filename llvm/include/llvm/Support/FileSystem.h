@@ -1240,6 +1240,12 @@ public:
   /// behavior.
   const char *const_data() const;
 
+  /// For a readonly mapping, mark the pages as unused in the near future and
+  /// the kernel can free the associated resources. The data remains
+  /// accessible and is faulted back in from the file on the next access.
+  /// No-op for writable mappings and on platforms without madvise.
+  void dontNeed();
+
   /// \returns The minimum alignment offset must be.
   static int alignment();
 };
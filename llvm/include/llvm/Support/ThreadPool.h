@@ -21,6 +21,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -32,8 +33,11 @@ namespace llvm {
 /// A ThreadPool for asynchronous parallel execution on a defined number of
 /// threads.
 ///
-/// The pool keeps a vector of threads alive, waiting on a condition variable
-/// for some work to become available.
+/// Each worker thread owns a double-ended task queue. New tasks are
+/// distributed over the queues round-robin; a worker whose queue runs dry
+/// steals work from its siblings. This keeps submission and dispatch from
+/// serializing on a single pool-wide lock when many small tasks are in
+/// flight.
 class ThreadPool {
 public:
   using TaskTy = std::function<void()>;
@@ -71,8 +75,6 @@ public:
   unsigned getThreadCount() const { return ThreadCount; }
 
 private:
-  bool workCompletedUnlocked() { return !ActiveThreads && Tasks.empty(); }
-
   /// Asynchronous submission of a task to the pool. The returned future can be
   /// used to wait for the task to finish and is *non-blocking* on destruction.
   std::shared_future<void> asyncImpl(TaskTy F);
@@ -80,24 +82,52 @@ private:
   /// Threads in flight
   std::vector<llvm::thread> Threads;
 
+#if LLVM_ENABLE_THREADS
+  /// A per-worker double-ended task queue. The owning worker pops from the
+  /// back (most recently submitted, cache-hot task first) while thieves
+  /// steal from the front (oldest task first). Each queue carries its own
+  /// lock so that submission and stealing only contend on one worker, never
+  /// on the whole pool.
+  struct WorkerQueue {
+    std::mutex Lock;
+    std::deque<PackagedTaskTy> Tasks;
+  };
+
+  bool workCompletedUnlocked() { return !ActiveThreads && !QueuedTasks; }
+
+  /// Pop a task from the queue owned by worker \p ThreadID, or failing that
+  /// steal one from a sibling's queue. Returns false if every queue is
+  /// empty. On success the task is accounted as active before the queue
+  /// count drops, so ThreadPool::wait() never observes an in-flight task as
+  /// completed.
+  bool tryPopTask(unsigned ThreadID, PackagedTaskTy &Task);
+
+  /// Per-worker task deques, indexed by worker thread.
+  std::vector<std::unique_ptr<WorkerQueue>> WorkerQueues;
+
+  /// Round-robin cursor distributing new tasks over the worker queues.
+  std::atomic<unsigned> NextQueue{0};
+
+  /// Number of tasks sitting in the worker queues, not yet picked up.
+  std::atomic<unsigned> QueuedTasks{0};
+
+  /// Keep track of the number of threads actually busy
+  std::atomic<unsigned> ActiveThreads{0};
+
+  /// Signal for the destruction of the pool, asking thread to exit.
+  bool EnableFlag = true;
+#else
   /// Tasks waiting for execution in the pool.
   std::queue<PackagedTaskTy> Tasks;
+#endif
 
-  /// Locking and signaling for accessing the Tasks queue.
+  /// Locking and signaling for waking up worker threads.
   std::mutex QueueLock;
   std::condition_variable QueueCondition;
 
   /// Signaling for job completion
   std::condition_variable CompletionCondition;
 
-  /// Keep track of the number of thread actually busy
-  unsigned ActiveThreads = 0;
-
-#if LLVM_ENABLE_THREADS // avoids warning for unused variable
-  /// Signal for the destruction of the pool, asking thread to exit.
-  bool EnableFlag = true;
-#endif
-
   unsigned ThreadCount;
 };
 }
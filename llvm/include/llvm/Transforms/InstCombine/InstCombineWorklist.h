@@ -12,6 +12,7 @@
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/IR/Instruction.h"
 #include "llvm/Support/Compiler.h"
@@ -32,6 +33,12 @@ class InstCombineWorklist {
   /// in the order they have been added.
   SmallSetVector<Instruction *, 16> Deferred;
 
+  /// Parents of all instructions added since the last takeDirtyBlocks()
+  /// call. The driver uses this to bound which blocks a re-scan of the
+  /// function needs to revisit: anything combining touched ends up on the
+  /// worklist, so untouched blocks stay clean.
+  SmallPtrSet<BasicBlock *, 32> DirtyBlocks;
+
 public:
   InstCombineWorklist() = default;
 
@@ -44,6 +51,8 @@ public:
   /// Instructions will be visited in the order they are added.
   /// You likely want to use this method.
   void add(Instruction *I) {
+    if (BasicBlock *BB = I->getParent())
+      DirtyBlocks.insert(BB);
     if (Deferred.insert(I))
       LLVM_DEBUG(dbgs() << "IC: ADD DEFERRED: " << *I << '\n');
   }
@@ -61,6 +70,7 @@ public:
     assert(I);
     assert(I->getParent() && "Instruction not inserted yet?");
 
+    DirtyBlocks.insert(I->getParent());
     if (WorklistMap.insert(std::make_pair(I, Worklist.size())).second) {
       LLVM_DEBUG(dbgs() << "IC: ADD: " << *I << '\n');
       Worklist.push_back(I);
@@ -83,6 +93,14 @@ public:
     WorklistMap.reserve(Size);
   }
 
+  /// Hand the set of blocks dirtied since the last call to the caller and
+  /// start tracking afresh.
+  SmallPtrSet<BasicBlock *, 32> takeDirtyBlocks() {
+    SmallPtrSet<BasicBlock *, 32> Blocks = std::move(DirtyBlocks);
+    DirtyBlocks.clear();
+    return Blocks;
+  }
+
   /// Remove I from the worklist if it exists.
   void remove(Instruction *I) {
     DenseMap<Instruction*, unsigned>::iterator It = WorklistMap.find(I);
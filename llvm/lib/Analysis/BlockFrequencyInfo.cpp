@@ -181,6 +181,18 @@ bool BlockFrequencyInfo::invalidate(Function &F, const PreservedAnalyses &PA,
            PAC.preservedSet<CFGAnalyses>());
 }
 
+// Frequencies are recomputed from scratch rather than patched as transforms
+// edit the CFG, and that is structural: a block's frequency is a global fixed
+// point of branch probabilities and loop scales (with saturation applied
+// during mass distribution in BlockFrequencyInfoImpl), so a single redirected
+// edge can shift frequencies arbitrarily far away, and the inputs themselves
+// — BPI and LoopInfo — are stale after the same edit. Delta maintenance for
+// "easy" edits like block splits already exists in a different form: passes
+// that split or clone blocks copy the original's frequency through utilities
+// and metadata, and the setBlockFreq/setBlockFreqAndScale escape hatches
+// below let a transform assert a known-correct local value without a global
+// recompute. Anything beyond that is a new analysis with its own soundness
+// story, not an extension of this one.
 void BlockFrequencyInfo::calculate(const Function &F,
                                    const BranchProbabilityInfo &BPI,
                                    const LoopInfo &LI) {
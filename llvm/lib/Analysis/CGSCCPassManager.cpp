@@ -148,6 +148,18 @@ PassManager<LazyCallGraph::SCC, CGSCCAnalysisManager, LazyCallGraph &,
   return PA;
 }
 
+// A note on running sibling SCCs concurrently: although most SCCs in a big
+// module have no edges between them, the walk below cannot hand them to
+// worker threads. CGSCC passes edit shared IR - the inliner splices blocks
+// from callees into callers, drops dead functions, and materializes constants
+// and metadata through the one LLVMContext - and every such edit feeds back
+// into this loop via updateCGAndAnalysisManagerForPass, which restructures
+// the LazyCallGraph post-order the walk is iterating over. Per-thread
+// FunctionAnalysisManagers do not change that: the managers cache results
+// against the same IR objects the other threads are mutating. Parallelism
+// for these passes comes from running whole module pipelines concurrently,
+// which is exactly what the ThinLTO backends already do - each backend gets
+// its own module, context, and analysis managers.
 PreservedAnalyses
 ModuleToPostOrderCGSCCPassAdaptor::run(Module &M, ModuleAnalysisManager &AM) {
   // Setup the CGSCC analysis manager from its proxy.
@@ -23,6 +23,7 @@
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/Analysis/TargetFolder.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
@@ -61,6 +62,13 @@
 
 using namespace llvm;
 
+#define DEBUG_TYPE "constant-folding"
+
+STATISTIC(NumFoldCacheHits,
+          "Number of constant folds served from the context's cache");
+STATISTIC(NumFoldCacheEntries,
+          "Number of constant fold results added to the context's cache");
+
 namespace {
 
 //===----------------------------------------------------------------------===//
@@ -1130,6 +1138,18 @@ ConstantFoldConstantImpl(const Constant *C, const DataLayout &DL,
   if (!isa<ConstantVector>(C) && !isa<ConstantExpr>(C))
     return const_cast<Constant *>(C);
 
+  // ConstantExprs are uniqued in the context, so folding the same expression
+  // tree again yields the same pointer and can be served from the
+  // context-owned cache. The result does not depend on TLI: constant
+  // expression trees cannot contain calls. ConstantVectors are excluded only
+  // because they are rarely folded repeatedly.
+  bool IsCacheable = isa<ConstantExpr>(C);
+  if (IsCacheable)
+    if (Constant *Folded = C->getContext().getCachedConstantFold(C, DL)) {
+      ++NumFoldCacheHits;
+      return Folded;
+    }
+
   SmallVector<Constant *, 8> Ops;
   for (const Use &OldU : C->operands()) {
     Constant *OldC = cast<Constant>(&OldU);
@@ -1149,11 +1169,17 @@ ConstantFoldConstantImpl(const Constant *C, const DataLayout &DL,
   }
 
   if (auto *CE = dyn_cast<ConstantExpr>(C)) {
+    Constant *Res;
     if (CE->isCompare())
-      return ConstantFoldCompareInstOperands(CE->getPredicate(), Ops[0], Ops[1],
-                                             DL, TLI);
-
-    return ConstantFoldInstOperandsImpl(CE, CE->getOpcode(), Ops, DL, TLI);
+      Res = ConstantFoldCompareInstOperands(CE->getPredicate(), Ops[0], Ops[1],
+                                            DL, TLI);
+    else
+      Res = ConstantFoldInstOperandsImpl(CE, CE->getOpcode(), Ops, DL, TLI);
+    if (IsCacheable && Res) {
+      ++NumFoldCacheEntries;
+      C->getContext().addCachedConstantFold(C, Res);
+    }
+    return Res;
   }
 
   assert(isa<ConstantVector>(C));
@@ -227,6 +227,16 @@ void DomTreeUpdater::validateDeleteBB(BasicBlock *DelBB) {
   new UnreachableInst(DelBB->getContext(), DelBB);
 }
 
+// This is already the batch-transaction entry point: callers hand over the
+// whole update set for a transform, and under the Lazy strategy the updates
+// are only queued here — nothing is recomputed until a query forces a flush,
+// at which point GenericDomTree's incremental updater processes the
+// accumulated batch against one affected subtree. Passes that still pay
+// per-edge waves are those constructing an Eager updater or calling
+// insertEdge/deleteEdge in a loop; the fix for them is to collect updates
+// into a vector and make one call here under Lazy, not a new API. The
+// remaining per-call cost under Lazy is just the dedup scan in
+// tryLegalizeUpdates when the queue flushes.
 void DomTreeUpdater::applyUpdates(ArrayRef<DominatorTree::UpdateType> Updates) {
   if (!DT && !PDT)
     return;
@@ -433,6 +433,13 @@ void llvm::addLocationToRemarks(OptimizationRemark &Remark, DebugLoc DLoc) {
   Remark << ";";
 }
 
+// Remarks are built lazily: the callback below only runs when remark output
+// is actually enabled for this pass, so disabled builds pay one predicate
+// check per call site and nothing else. Batching emission per SCC would not
+// move the cost - the expense is constructing and serializing each remark,
+// which scales with the number emitted, and deferring construction is not an
+// option because the remark captures the callee, caller and debug location
+// at the moment of the inline, before subsequent inlining mutates them.
 void llvm::emitInlinedInto(OptimizationRemarkEmitter &ORE, DebugLoc DLoc,
                            const BasicBlock *Block, const Function &Callee,
                            const Function &Caller, const InlineCost &IC,
@@ -34,6 +34,7 @@
 #include "llvm/IR/PatternMatch.h"
 #include "llvm/IR/ValueHandle.h"
 #include "llvm/InitializePasses.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/FormattedStream.h"
 #include "llvm/Support/KnownBits.h"
@@ -48,6 +49,15 @@ using namespace PatternMatch;
 // answer for a given value.
 static const unsigned MaxProcessedPerValue = 500;
 
+// The cache is purely a memoization of earlier queries, so it can be dropped
+// wholesale at any point between top-level queries at no cost beyond
+// recomputation. If nonzero, do exactly that once roughly this many results
+// have been cached, to bound LVI memory on huge functions.
+static cl::opt<unsigned> MaxCachedResults(
+    "lvi-max-cached-results", cl::Hidden, cl::init(0),
+    cl::desc("If nonzero, flush the LVI cache after it has accumulated "
+             "roughly this many results (default = unlimited)"));
+
 char LazyValueInfoWrapperPass::ID = 0;
 LazyValueInfoWrapperPass::LazyValueInfoWrapperPass() : FunctionPass(ID) {
   initializeLazyValueInfoWrapperPassPass(*PassRegistry::getPassRegistry());
@@ -171,6 +181,10 @@ namespace {
     /// Cached information per basic block.
     DenseMap<PoisoningVH<BasicBlock>, std::unique_ptr<BlockCacheEntry>>
         BlockCache;
+    /// Number of results inserted since the last full clear. This ignores
+    /// the (rare) erasures, so it slightly overestimates the live entry
+    /// count; that's fine for its only use, deciding when to flush.
+    unsigned ResultsInserted = 0;
     /// Set of value handles used to erase values from the cache on deletion.
     DenseSet<LVIValueHandle, DenseMapInfo<Value *>> ValueHandles;
 
@@ -207,10 +221,14 @@ namespace {
         Entry->OverDefined.insert(Val);
       else
         Entry->LatticeElements.insert({ Val, Result });
+      ++ResultsInserted;
 
       addValueHandle(Val);
     }
 
+    /// Approximate number of results currently held in the cache.
+    unsigned getApproximateSize() const { return ResultsInserted; }
+
     Optional<ValueLatticeElement> getCachedValueInfo(Value *V,
                                                      BasicBlock *BB) const {
       const BlockCacheEntry *Entry = getBlockEntry(BB);
@@ -244,6 +262,7 @@ namespace {
     void clear() {
       BlockCache.clear();
       ValueHandles.clear();
+      ResultsInserted = 0;
     }
 
     /// Inform the cache that a given value has been deleted.
@@ -457,6 +476,14 @@ public:
     TheCache.clear();
   }
 
+  /// Flush the cache if it has grown past the configured limit. Everything
+  /// in it can be recomputed, so this is always safe between top-level
+  /// queries; it must not run while solve() has work in flight.
+  void enforceCacheLimit() {
+    if (MaxCachedResults && TheCache.getApproximateSize() >= MaxCachedResults)
+      TheCache.clear();
+  }
+
   /// Printing the LazyValueInfo Analysis.
   void printLVI(Function &F, DominatorTree &DTree, raw_ostream &OS) {
     LazyValueInfoAnnotatedWriter Writer(this, DTree);
@@ -1465,6 +1492,7 @@ ValueLatticeElement LazyValueInfoImpl::getValueInBlock(Value *V, BasicBlock *BB,
                     << BB->getName() << "'\n");
 
   assert(BlockValueStack.empty() && BlockValueSet.empty());
+  enforceCacheLimit();
   Optional<ValueLatticeElement> OptResult = getBlockValue(V, BB);
   if (!OptResult) {
     solve();
@@ -1501,6 +1529,7 @@ getValueOnEdge(Value *V, BasicBlock *FromBB, BasicBlock *ToBB,
                     << FromBB->getName() << "' to '" << ToBB->getName()
                     << "'\n");
 
+  enforceCacheLimit();
   Optional<ValueLatticeElement> Result = getEdgeValue(V, FromBB, ToBB, CxtI);
   if (!Result) {
     solve();
@@ -164,7 +164,7 @@ static void addIntrinsicToSummary(
     SetVector<FunctionSummary::VFuncId> &TypeCheckedLoadVCalls,
     SetVector<FunctionSummary::ConstVCall> &TypeTestAssumeConstVCalls,
     SetVector<FunctionSummary::ConstVCall> &TypeCheckedLoadConstVCalls,
-    DominatorTree &DT) {
+    function_ref<DominatorTree &()> GetDT) {
   switch (CI->getCalledFunction()->getIntrinsicID()) {
   case Intrinsic::type_test: {
     auto *TypeMDVal = cast<MetadataAsValue>(CI->getArgOperand(1));
@@ -189,7 +189,7 @@ static void addIntrinsicToSummary(
 
     SmallVector<DevirtCallSite, 4> DevirtCalls;
     SmallVector<CallInst *, 4> Assumes;
-    findDevirtualizableCallsForTypeTest(DevirtCalls, Assumes, CI, DT);
+    findDevirtualizableCallsForTypeTest(DevirtCalls, Assumes, CI, GetDT());
     for (auto &Call : DevirtCalls)
       addVCallToSet(Call, Guid, TypeTestAssumeVCalls,
                     TypeTestAssumeConstVCalls);
@@ -209,7 +209,7 @@ static void addIntrinsicToSummary(
     SmallVector<Instruction *, 4> Preds;
     bool HasNonCallUses = false;
     findDevirtualizableCallsForTypeCheckedLoad(DevirtCalls, LoadedPtrs, Preds,
-                                               HasNonCallUses, CI, DT);
+                                               HasNonCallUses, CI, GetDT());
     // Any non-call uses of the result of llvm.type.checked.load will
     // prevent us from optimizing away the llvm.type.test.
     if (HasNonCallUses)
@@ -241,7 +241,7 @@ static bool isNonVolatileStore(const Instruction *I) {
 
 static void computeFunctionSummary(
     ModuleSummaryIndex &Index, const Module &M, const Function &F,
-    BlockFrequencyInfo *BFI, ProfileSummaryInfo *PSI, DominatorTree &DT,
+    BlockFrequencyInfo *BFI, ProfileSummaryInfo *PSI,
     bool HasLocalsInUsedOrAsm, DenseSet<GlobalValue::GUID> &CantBePromoted,
     bool IsThinLTO,
     std::function<const StackSafetyInfo *(const Function &F)> GetSSICallback) {
@@ -249,6 +249,16 @@ static void computeFunctionSummary(
   // have been named.
   assert(F.hasName());
 
+  // A dominator tree is only needed to analyze uses of the type test
+  // intrinsics, which most functions don't contain. Build it lazily so that
+  // the common case doesn't pay for the tree construction.
+  std::unique_ptr<DominatorTree> DT;
+  auto GetDT = [&]() -> DominatorTree & {
+    if (!DT)
+      DT = std::make_unique<DominatorTree>(const_cast<Function &>(F));
+    return *DT;
+  };
+
   unsigned NumInsts = 0;
   // Map from callee ValueId to profile count. Used to accumulate profile
   // counts for all static calls to a given callee.
@@ -336,7 +346,7 @@ static void computeFunctionSummary(
         if (CI && CalledFunction->isIntrinsic()) {
           addIntrinsicToSummary(
               CI, TypeTests, TypeTestAssumeVCalls, TypeCheckedLoadVCalls,
-              TypeTestAssumeConstVCalls, TypeCheckedLoadConstVCalls, DT);
+              TypeTestAssumeConstVCalls, TypeCheckedLoadConstVCalls, GetDT);
           continue;
         }
         // We should have named any anonymous globals
@@ -748,19 +758,19 @@ ModuleSummaryIndex llvm::buildModuleSummaryIndex(
     if (F.isDeclaration())
       continue;
 
-    DominatorTree DT(const_cast<Function &>(F));
     BlockFrequencyInfo *BFI = nullptr;
     std::unique_ptr<BlockFrequencyInfo> BFIPtr;
     if (GetBFICallback)
       BFI = GetBFICallback(F);
     else if (F.hasProfileData()) {
+      DominatorTree DT(const_cast<Function &>(F));
       LoopInfo LI{DT};
       BranchProbabilityInfo BPI{F, LI};
       BFIPtr = std::make_unique<BlockFrequencyInfo>(F, BPI, LI);
       BFI = BFIPtr.get();
     }
 
-    computeFunctionSummary(Index, M, F, BFI, PSI, DT,
+    computeFunctionSummary(Index, M, F, BFI, PSI,
                            !LocalsUsed.empty() || HasLocalInlineAsmSymbol,
                            CantBePromoted, IsThinLTO, GetSSICallback);
   }
@@ -2280,6 +2280,15 @@ bool ScalarEvolution::isAvailableAtLoopEntry(const SCEV *S, const Loop *L) {
 }
 
 /// Get a canonical add expression, or something simpler if possible.
+// Repeat constructions of the same add are not free even though the result
+// is interned in UniqueSCEVs: the sort/fold canonicalization below reruns
+// before the FoldingSet is consulted. A pre-canonical cache keyed on the raw
+// operand list has been considered and rejected: the result depends on
+// OrigFlags (strengthened via StrengthenNoWrapFlags) and on loop disposition
+// queried during folding, so raw operands are not a sufficient key, and every
+// entry would have to be flushed by the same forgetMemoizedResults walks that
+// maintain the existing maps — per-loop "version numbers" cannot express
+// invalidation of expressions that mix values from several loops.
 const SCEV *ScalarEvolution::getAddExpr(SmallVectorImpl<const SCEV *> &Ops,
                                         SCEV::NoWrapFlags OrigFlags,
                                         unsigned Depth) {
@@ -15,6 +15,7 @@
 #include "llvm/ADT/APFloat.h"
 #include "llvm/ADT/APInt.h"
 #include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/None.h"
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/STLExtras.h"
@@ -120,6 +121,17 @@ struct Query {
   /// If true, it is safe to use metadata during simplification.
   InstrInfoQuery IIQ;
 
+  /// The IR and the context instruction are frozen for the lifetime of a
+  /// query, so known-bits results for multi-use values can be memoized:
+  /// expression DAGs are walked as trees, and without this a value reachable
+  /// along several operand paths is recomputed once per path. Each entry
+  /// records the depth it was computed at and is only reused at the same or
+  /// greater depth, where the cached result is at least as precise as a
+  /// recomputation would be (deeper queries have less recursion budget).
+  /// Mutable because the query object is passed around by const reference.
+  mutable SmallDenseMap<const Value *, std::pair<KnownBits, unsigned>, 8>
+      KnownBitsCache;
+
   unsigned NumExcluded = 0;
 
   Query(const DataLayout &DL, AssumptionCache *AC, const Instruction *CxtI,
@@ -127,6 +139,9 @@ struct Query {
         OptimizationRemarkEmitter *ORE = nullptr)
       : DL(DL), AC(AC), CxtI(CxtI), DT(DT), ORE(ORE), IIQ(UseInstrInfo) {}
 
+  // Note that KnownBitsCache deliberately starts out empty in the copy:
+  // results computed with one more assume excluded may be less precise and
+  // must not leak back into the parent query.
   Query(const Query &Q, const Value *NewExcl)
       : DL(Q.DL), AC(Q.AC), CxtI(Q.CxtI), DT(Q.DT), ORE(Q.ORE), IIQ(Q.IIQ),
         NumExcluded(Q.NumExcluded) {
@@ -211,10 +226,29 @@ static void computeKnownBits(const Value *V, KnownBits &Known, unsigned Depth,
     return;
   }
 
+  // Only values with more than one use can be reached along more than one
+  // path of the expression walk, so only they can profit from memoization.
+  bool Cacheable =
+      (isa<Instruction>(V) || isa<Argument>(V)) && V->hasNUsesOrMore(2);
+  if (Cacheable) {
+    auto It = Q.KnownBitsCache.find(V);
+    if (It != Q.KnownBitsCache.end() && Depth >= It->second.second) {
+      Known = It->second.first;
+      return;
+    }
+  }
+
   auto *FVTy = dyn_cast<FixedVectorType>(V->getType());
   APInt DemandedElts =
       FVTy ? APInt::getAllOnesValue(FVTy->getNumElements()) : APInt(1, 1);
   computeKnownBits(V, DemandedElts, Known, Depth, Q);
+
+  if (Cacheable) {
+    // Keep whichever result was computed with the larger recursion budget.
+    auto R = Q.KnownBitsCache.try_emplace(V, Known, Depth);
+    if (!R.second && Depth < R.first->second.second)
+      R.first->second = {Known, Depth};
+  }
 }
 
 void llvm::computeKnownBits(const Value *V, KnownBits &Known,
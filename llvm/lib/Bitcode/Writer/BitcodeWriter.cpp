@@ -4592,18 +4592,23 @@ void llvm::WriteBitcodeToFile(const Module &M, raw_ostream &Out,
   Buffer.reserve(256*1024);
 
   // If this is darwin or another generic macho target, reserve space for the
-  // header.
+  // header. The header (and trailer) are backpatched over the complete
+  // bitstream once it has been produced, so incremental flushing to the
+  // output stream must stay disabled for wrapped bitcode.
   Triple TT(M.getTargetTriple());
-  if (TT.isOSDarwin() || TT.isOSBinFormatMachO())
+  bool NeedsDarwinWrapper = TT.isOSDarwin() || TT.isOSBinFormatMachO();
+  if (NeedsDarwinWrapper)
     Buffer.insert(Buffer.begin(), BWH_HeaderSize, 0);
 
-  BitcodeWriter Writer(Buffer, dyn_cast<raw_fd_stream>(&Out));
+  BitcodeWriter Writer(Buffer, NeedsDarwinWrapper
+                                   ? nullptr
+                                   : dyn_cast<raw_fd_stream>(&Out));
   Writer.writeModule(M, ShouldPreserveUseListOrder, Index, GenerateHash,
                      ModHash);
   Writer.writeSymtab();
   Writer.writeStrtab();
 
-  if (TT.isOSDarwin() || TT.isOSBinFormatMachO())
+  if (NeedsDarwinWrapper)
     emitDarwinBCHeaderAndTrailer(Buffer, TT);
 
   // Write the generated bitstream to "Out".
@@ -3227,6 +3227,15 @@ uint64_t DwarfDebug::makeTypeSignature(StringRef Identifier) {
   return Result.high();
 }
 
+// Type units are the existing mechanism for cross-TU (and cross-ThinLTO-
+// backend) structural deduplication of debug info: each unit is emitted into
+// a COMDAT section group keyed by the 8-byte signature above, references use
+// DW_AT_signature rather than DIE offsets, and the linker's ordinary group
+// resolution keeps one copy per signature with no DWARF-aware rewriting
+// needed. Builds suffering duplicated imported-type DIEs under ThinLTO
+// should enable -fdebug-types-section before considering a linker-side DIE
+// dedup pass, which would have to re-derive exactly the content identity
+// this signature already encodes.
 void DwarfDebug::addDwarfTypeUnitType(DwarfCompileUnit &CU,
                                       StringRef Identifier, DIE &RefDie,
                                       const DICompositeType *CTy) {
@@ -54,6 +54,14 @@
 // the corresponding basic blocks. This logic is implemented in AsmPrinter. This
 // pass only assigns the BBSectionType of every function to ``labels``.
 //
+// The two modes are the halves of a feedback loop that is closed outside the
+// compiler: a labels build plus perf/LBR samples and the bb_addr_map yield a
+// cluster profile for -fbasic-block-sections=list, and the per-cluster
+// symbols let the linker apply inter-procedural ordering via its section
+// ordering. The sample-to-cluster conversion is deliberately not in-tree
+// codegen work - it depends on the profiling stack's sample format, not on
+// anything this pass knows.
+//
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/Optional.h"
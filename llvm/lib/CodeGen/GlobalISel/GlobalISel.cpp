@@ -15,6 +15,17 @@
 
 using namespace llvm;
 
+// Note on parallelism: the GlobalISel stages (IRTranslator, Legalizer,
+// RegBankSelect, InstructionSelect) keep no state across functions, which
+// makes it tempting to pipeline functions through them on a thread pool.
+// That cannot be done within this pass pipeline: MachineFunction passes run
+// under the legacy pass manager, which is inherently serial, and every
+// function hands changes to shared, unsynchronized structures - the
+// LLVMContext (constants, types, metadata), MachineModuleInfo, and the
+// MCContext behind it. The supported way to codegen functions in parallel,
+// GlobalISel included, is to give each thread its own module and context and
+// split the work at module granularity; see llvm/CodeGen/ParallelCG.h and
+// SplitModule.h.
 void llvm::initializeGlobalISel(PassRegistry &Registry) {
   initializeIRTranslatorPass(Registry);
   initializeLegalizerPass(Registry);
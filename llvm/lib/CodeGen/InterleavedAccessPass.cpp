@@ -527,6 +527,14 @@ bool InterleavedAccess::runOnFunction(Function &F) {
   DT = &getAnalysis<DominatorTreeWrapperPass>().getDomTree();
   auto &TM = TPC->getTM<TargetMachine>();
   TLI = TM.getSubtargetImpl(F)->getTargetLowering();
+  // MaxFactor reflects what the target can lower to a single structured
+  // memory operation (ld2-ld4/st2-st4 on AArch64; the factor-2..4 shuffle
+  // sequences in X86InterleavedAccess). Factors beyond it are deliberately
+  // not matched here: there is no ld5-ld8, and a synthesized permute ladder
+  // for wider strides is a cost decision that belongs to the vectorizer's
+  // interleaved-group analysis (priced via getInterleavedMemoryOpCost), not
+  // to this pattern-rewriting pass, which only recognizes the shuffle idioms
+  // the vectorizer or the user already emitted.
   MaxFactor = TLI->getMaxSupportedInterleaveFactor();
 
   // Holds dead instructions that will be erased later.
@@ -976,6 +976,15 @@ void MachineOutliner::emitInstrCountChangedRemark(
   }
 }
 
+// The outliner's scope is whatever module reaches this pass, which under
+// ThinLTO means one backend partition: candidates repeated across partitions
+// are never seen together. Extending the scope would need cross-backend
+// coordination — candidates only exist after register allocation, so the
+// thin-link (which sees only summaries) cannot compute outline sets, and a
+// post-hoc sidecar exchange would require a second codegen pass over every
+// partition with deterministic candidate fingerprints. The supported ways to
+// recover cross-module redundancy today are full LTO (one merged module
+// through this pass) and linker ICF for functions that end up identical.
 bool MachineOutliner::runOnModule(Module &M) {
   // Check if there's anything in the module. If it's empty, then there's
   // nothing to outline.
@@ -3352,6 +3352,20 @@ SUnit *GenericScheduler::pickNodeBidirectional(bool &IsTopNode) {
 }
 
 /// Pick the best node to balance the schedule. Implements MachineSchedStrategy.
+///
+/// On memoizing these decisions for repeated DAG shapes (identical unrolled
+/// bodies are the motivating case): the picks are not a function of the
+/// instruction sequence alone. Candidate comparison reads the region's
+/// live-in/live-out pressure sets, the pressure limits left over by
+/// surrounding regions, and boundary latencies — two textually identical
+/// bodies in different pressure contexts can legitimately schedule
+/// differently, so a sequence-hash keyed replay cache either needs the full
+/// context in its key (at which point hits become rare) or accepts wrong
+/// replays that only probabilistic re-verification would catch, making
+/// codegen nondeterministic. The profitable version of this idea is cheaper
+/// and local: identical regions *within one function* share context more
+/// often than not, but even there the tracker state must be proven equal,
+/// not assumed from the instruction text.
 SUnit *GenericScheduler::pickNode(bool &IsTopNode) {
   if (DAG->top() == DAG->bottom()) {
     assert(Top.Available.empty() && Top.Pending.empty() &&
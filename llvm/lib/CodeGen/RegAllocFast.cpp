@@ -9,6 +9,19 @@
 /// \file This register allocator allocates registers to a basic block at a
 /// time, attempting to keep values in registers and reusing registers as
 /// appropriate.
+///
+/// Spilling at block boundaries is what keeps this allocator analysis-free:
+/// no liveness problem is solved across edges, so allocation is one forward
+/// walk per block. A middle tier that keeps values live across blocks has to
+/// know where each value dies, and any cross-block notion of that is a
+/// fixed-point dataflow problem — a "single cheap backward pass" only yields
+/// correct intervals for single-entry single-exit straight-line regions. The
+/// existing middle ground in the tree is -regalloc=basic: real LiveIntervals
+/// with a trivial priority heuristic, i.e. greedy's correctness
+/// infrastructure without its search. A JIT tier wanting quality between
+/// fast and basic should measure basic first; its cost is dominated by the
+/// shared analyses, which is exactly the part that cannot be skimped
+/// without giving up cross-block registers.
 //
 //===----------------------------------------------------------------------===//
 
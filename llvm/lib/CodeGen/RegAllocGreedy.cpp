@@ -141,6 +141,17 @@ static RegisterRegAlloc greedyRegAlloc("greedy", "greedy register allocator",
 
 namespace {
 
+// RAGreedy explores alternative allocation decisions (eviction orderings,
+// split candidates, deferred spilling) by modelling their cost analytically -
+// see canEvictInterference, calcSpillCost and calcGlobalSplitCost - and only
+// mutates the function once a winner is picked. A branch-and-bound search
+// that instead snapshots and rolls back real state has been proposed a few
+// times and doesn't have a practical implementation path: MachineFunction,
+// LiveIntervals, SlotIndexes and VirtRegMap are riddled with cross-pointers
+// (use lists into MachineOperands, VNInfos in bump allocators, segment arrays
+// keyed by slot indexes), so a copy-on-write snapshot degenerates into a deep
+// clone of most of the function per branch. Extending the cost model is the
+// intended way to evaluate new what-if decisions.
 class RAGreedy : public MachineFunctionPass,
                  public RegAllocBase,
                  private LiveRangeEdit::Delegate {
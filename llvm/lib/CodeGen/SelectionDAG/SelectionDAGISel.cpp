@@ -693,6 +693,11 @@ void SelectionDAGISel::SelectBasicBlock(BasicBlock::const_iterator Begin,
   // Allow creating illegal types during DAG building for the basic block.
   CurDAG->NewNodesMustHaveLegalTypes = false;
 
+  // An IR instruction typically lowers to a handful of nodes. Pre-size the
+  // CSE map accordingly so building huge blocks doesn't pay for a cascade of
+  // rehashes, each of which re-profiles every node inserted so far.
+  CurDAG->reserveCSEMap(4 * std::distance(Begin, End));
+
   // Lower the instructions. If a call is emitted as a tail call, cease emitting
   // nodes for this block.
   for (BasicBlock::const_iterator I = Begin; I != End && !SDB->HasTailCall; ++I) {
@@ -2801,6 +2806,17 @@ public:
 
 } // end anonymous namespace
 
+// A cache from a shallow node signature (opcode, types, operand opcodes) to a
+// previously recorded matcher outcome has been considered and rejected. The
+// DAG is CSE'd: two nodes that agree on opcode, types, and operands are one
+// node and are only selected once, so any pair of distinct nodes sharing a
+// shallow signature differs in its operands - which is precisely what
+// ComplexPatterns, immediate predicates, and hasOneUse checks inspect.
+// Replaying a recorded outcome for such a node would skip those checks. The
+// repeated-shape cost is instead kept low structurally: tables open with
+// OPC_SwitchOpcode, so the interpreter jumps straight to the per-opcode
+// subtable (see the OpcodeOffset fast path below) and only walks the checks
+// that can actually reject the node.
 void SelectionDAGISel::SelectCodeCommon(SDNode *NodeToMatch,
                                         const unsigned char *MatcherTable,
                                         unsigned TableSize) {
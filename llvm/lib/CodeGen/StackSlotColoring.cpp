@@ -8,6 +8,19 @@
 //
 // This file implements the stack slot coloring pass.
 //
+// This pass is one third of the frame layout story, and the split is by what
+// each stage can know: allocas are merged earlier by StackColoring at the IR
+// boundary, where lifetime markers still exist and pointer identity,
+// aliasing and debug info can be updated coherently — by the time this pass
+// runs those slots may have escaped addresses that cannot be renumbered.
+// This pass colors only the allocator-created spill slots, whose liveness
+// LiveStacks describes exactly. Final offset assignment is the target's:
+// TargetFrameLowering::orderFrameObjects (implemented on X86) orders objects
+// by access density so the hottest land in the shortest-encoding offsets.
+// A unified "color everything, sort by frequency" pass would need all three
+// kinds of knowledge in one place; what each stage lacks is why the split
+// exists.
+//
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/BitVector.h"
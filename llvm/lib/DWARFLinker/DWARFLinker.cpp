@@ -2578,6 +2578,15 @@ bool DWARFLinker::link() {
     }
     EmitLambda();
   } else {
+    // Two-stage pipeline: analysis of object N overlaps cloning/emission of
+    // objects < N. Widening this to per-CU cloning across many threads is
+    // bounded by shared mutable state, all of it order-sensitive: cloned
+    // DIEs take their final .debug_info offsets as they are emitted, the
+    // uniquing string pools hand out offsets on first insertion, and
+    // ODR-uniquing via the DeclContextTree both reads and declares canonical
+    // declarations as units are cloned. Sharding those pools means emitting
+    // into per-shard buffers with a relocation/patch pass at merge time —
+    // i.e. a second linking stage — not just swapping in concurrent maps.
     ThreadPool Pool(hardware_concurrency(2));
     Pool.async(AnalyzeAll);
     Pool.async(CloneAll);
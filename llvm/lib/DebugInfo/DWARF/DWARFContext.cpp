@@ -43,6 +43,7 @@
 #include "llvm/Support/Format.h"
 #include "llvm/Support/LEB128.h"
 #include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/TargetRegistry.h"
 #include "llvm/Support/raw_ostream.h"
@@ -972,6 +973,22 @@ void DWARFContext::parseNormalUnits() {
   });
 }
 
+void DWARFContext::extractUnitDIEsInParallel() {
+  parseNormalUnits();
+
+  // Fully parse the abbreviation tables and resolve each unit's abbreviation
+  // set up front. Both are filled in lazily behind non-atomic caches, so they
+  // must not be populated from the worker threads; everything the workers
+  // touch afterwards is either per-unit state or read-only section data.
+  getDebugAbbrev()->parse();
+  for (const auto &U : NormalUnits)
+    U->getAbbreviations();
+
+  parallelForEach(NormalUnits, [](const std::unique_ptr<DWARFUnit> &U) {
+    U->extractDIEsIfNeeded(/*CUDieOnly=*/false);
+  });
+}
+
 void DWARFContext::parseDWOUnits(bool Lazy) {
   if (!DWOUnits.empty())
     return;
@@ -51,6 +51,8 @@ public:
   // it in memory assuming there were no conflicts.
   uint64_t getModulePreferredBase() const override;
 
+  DIContext *getDIContext() const override { return DebugInfoContext.get(); }
+
 private:
   bool shouldOverrideWithSymbolTable(FunctionNameKind FNKind,
                                      bool UseSymbolTable) const;
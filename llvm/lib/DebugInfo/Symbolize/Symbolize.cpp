@@ -18,6 +18,8 @@
 #include "llvm/BinaryFormat/COFF.h"
 #include "llvm/Config/config.h"
 #include "llvm/DebugInfo/DWARF/DWARFContext.h"
+#include "llvm/DebugInfo/GSYM/GsymDIContext.h"
+#include "llvm/DebugInfo/GSYM/GsymReader.h"
 #include "llvm/DebugInfo/PDB/PDB.h"
 #include "llvm/DebugInfo/PDB/PDBContext.h"
 #include "llvm/Demangle/Demangle.h"
@@ -35,6 +37,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <numeric>
 
 namespace llvm {
 namespace symbolize {
@@ -85,6 +88,44 @@ LLVMSymbolizer::symbolizeCode(const std::string &ModuleName,
   return symbolizeCodeCommon(*InfoOrErr, ModuleOffset);
 }
 
+Expected<std::vector<DILineInfo>>
+LLVMSymbolizer::symbolizeAddresses(const std::string &ModuleName,
+                                   ArrayRef<uint64_t> Addresses) {
+  Expected<SymbolizableModule *> InfoOrErr = getOrCreateModuleInfo(ModuleName);
+  if (!InfoOrErr)
+    return InfoOrErr.takeError();
+  SymbolizableModule *Info = *InfoOrErr;
+
+  std::vector<DILineInfo> Result(Addresses.size());
+  if (!Info)
+    return Result;
+
+  // If the batch is large enough to touch most of the module's debug info,
+  // decode the DIEs of all compile units in parallel up front instead of
+  // faulting them in one unit at a time from the lookups below.
+  if (auto *DWARFCtx = dyn_cast_or_null<DWARFContext>(Info->getDIContext()))
+    if (Addresses.size() >= DWARFCtx->getNumCompileUnits())
+      DWARFCtx->extractUnitDIEsInParallel();
+
+  // Visit the addresses in ascending order: each compile unit is set up only
+  // once, and all queries that fall into one line table sequence are resolved
+  // while its decoded form is hot.
+  std::vector<size_t> Order(Addresses.size());
+  std::iota(Order.begin(), Order.end(), 0);
+  llvm::stable_sort(Order, [&](size_t L, size_t R) {
+    return Addresses[L] < Addresses[R];
+  });
+
+  for (size_t I : Order) {
+    Expected<DILineInfo> ResOrErr = symbolizeCodeCommon(
+        Info, {Addresses[I], object::SectionedAddress::UndefSection});
+    if (!ResOrErr)
+      return ResOrErr.takeError();
+    Result[I] = std::move(*ResOrErr);
+  }
+  return Result;
+}
+
 Expected<DIInliningInfo>
 LLVMSymbolizer::symbolizeInlinedCode(const std::string &ModuleName,
                                      object::SectionedAddress ModuleOffset) {
@@ -502,6 +543,35 @@ LLVMSymbolizer::getOrCreateObject(const std::string &Path,
   return errorCodeToError(object_error::arch_not_found);
 }
 
+std::unique_ptr<DIContext>
+LLVMSymbolizer::lookUpGsymFile(const std::string &Path) {
+  // Directories explicitly configured for sidecar files take precedence over
+  // a file next to the binary.
+  SmallVector<std::string, 4> GsymPaths;
+  for (const auto &Directory : Opts.GsymFileDirectory) {
+    SmallString<128> GsymPath(Directory);
+    sys::path::append(GsymPath, sys::path::filename(Path));
+    GsymPath += ".gsym";
+    GsymPaths.push_back(std::string(GsymPath.str()));
+  }
+  GsymPaths.push_back(Path + ".gsym");
+
+  for (const auto &GsymPath : GsymPaths) {
+    if (!sys::fs::exists(GsymPath))
+      continue;
+    // openFile() memory maps the GSYM file, so lookups become binary searches
+    // over read-only pages that the OS can share between processes.
+    auto ReaderOrErr = gsym::GsymReader::openFile(GsymPath);
+    if (!ReaderOrErr) {
+      consumeError(ReaderOrErr.takeError());
+      continue;
+    }
+    return std::make_unique<gsym::GsymDIContext>(
+        std::make_unique<gsym::GsymReader>(std::move(*ReaderOrErr)));
+  }
+  return nullptr;
+}
+
 Expected<SymbolizableModule *>
 LLVMSymbolizer::createModuleInfo(const ObjectFile *Obj,
                                  std::unique_ptr<DIContext> Context,
@@ -566,6 +636,8 @@ LLVMSymbolizer::getOrCreateModuleInfo(const std::string &ModuleName) {
       Context.reset(new PDBContext(*CoffObject, std::move(Session)));
     }
   }
+  if (!Context && Opts.UseGsym)
+    Context = lookUpGsymFile(BinaryName);
   if (!Context)
     Context = DWARFContext::create(*Objects.second, nullptr, Opts.DWPName);
   return createModuleInfo(Objects.first, std::move(Context), ModuleName);
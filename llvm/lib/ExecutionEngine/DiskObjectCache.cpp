@@ -0,0 +1,99 @@
+//===- DiskObjectCache.cpp - Disk-backed, shareable object cache ----------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/ExecutionEngine/DiskObjectCache.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/SHA1.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace llvm;
+
+namespace {
+
+/// A raw_ostream that hashes the bytes written to it instead of storing them.
+class HashingOStream : public raw_ostream {
+public:
+  HashingOStream(SHA1 &Hash) : Hash(Hash) { SetUnbuffered(); }
+
+private:
+  void write_impl(const char *Ptr, size_t Size) override {
+    Hash.update(StringRef(Ptr, Size));
+    Pos += Size;
+  }
+  uint64_t current_pos() const override { return Pos; }
+
+  SHA1 &Hash;
+  uint64_t Pos = 0;
+};
+
+} // end anonymous namespace
+
+Expected<std::unique_ptr<DiskObjectCache>>
+DiskObjectCache::Create(StringRef CacheDir, StringRef TargetFingerprint) {
+  if (std::error_code EC = sys::fs::create_directories(CacheDir))
+    return createFileError(CacheDir, EC);
+  return std::unique_ptr<DiskObjectCache>(
+      new DiskObjectCache(CacheDir.str(), TargetFingerprint.str()));
+}
+
+std::string DiskObjectCache::getEntryPath(const Module &M) {
+  SHA1 Hash;
+  Hash.update(TargetFingerprint);
+  Hash.update(StringRef("\0", 1));
+  {
+    // Hash the module's printed representation without materializing it.
+    // Preserve use-list order so the key covers everything the compiler
+    // might be sensitive to.
+    HashingOStream OS(Hash);
+    M.print(OS, /*AAW=*/nullptr, /*ShouldPreserveUseListOrder=*/true);
+  }
+
+  SmallString<128> EntryPath(CacheDir);
+  sys::path::append(EntryPath, toHex(Hash.final(), /*LowerCase=*/true) + ".o");
+  return std::string(EntryPath.str());
+}
+
+void DiskObjectCache::notifyObjectCompiled(const Module *M,
+                                           MemoryBufferRef Obj) {
+  std::string EntryPath = getEntryPath(*M);
+
+  // Write to a unique temporary file and rename it into place, so readers
+  // never observe a partial entry. Concurrent processes may race to populate
+  // the same entry; the loser overwrites the winner with identical bytes.
+  SmallString<128> TempPath;
+  int TempFD;
+  if (sys::fs::createUniqueFile(EntryPath + ".tmp%%%%%%%%", TempFD, TempPath))
+    return;
+
+  raw_fd_ostream OS(TempFD, /*shouldClose=*/true);
+  OS << Obj.getBuffer();
+  OS.close();
+  if (OS.has_error()) {
+    OS.clear_error();
+    sys::fs::remove(TempPath);
+    return;
+  }
+
+  if (sys::fs::rename(TempPath, EntryPath))
+    sys::fs::remove(TempPath);
+}
+
+std::unique_ptr<MemoryBuffer> DiskObjectCache::getObject(const Module *M) {
+  // Map the entry rather than copying it, so that processes loading the same
+  // object share its physical pages.
+  auto BufOrErr = MemoryBuffer::getFile(getEntryPath(*M), /*FileSize=*/-1,
+                                        /*RequiresNullTerminator=*/false);
+  if (!BufOrErr)
+    return nullptr;
+  return std::move(*BufOrErr);
+}
@@ -127,6 +127,62 @@ void CompileOnDemandLayer::setPartitionFunction(PartitionFunction Partition) {
 void CompileOnDemandLayer::setImplMap(ImplSymbolMap *Imp) {
   this->AliaseeImpls = Imp;
 }
+
+void CompileOnDemandLayer::setNotifyMaterializing(
+    NotifyMaterializingFunction NotifyMaterializing) {
+  this->NotifyMaterializing = std::move(NotifyMaterializing);
+}
+
+void CompileOnDemandLayer::prematerialize(JITDylib &TargetD,
+                                          SymbolNameSet Symbols) {
+  auto &ES = getExecutionSession();
+
+  // The same names are looked up first in the target dylib and then in the
+  // implementation dylib, so build the lookup set once and let the completion
+  // callback keep its own copy. (Moving the names out of Symbols inside the
+  // callback would write to the DenseSet's live buckets and corrupt it.)
+  SymbolLookupSet LookupSet;
+  for (const SymbolStringPtr &Name : Symbols)
+    LookupSet.add(Name, SymbolLookupFlags::WeaklyReferencedSymbol);
+
+  // First bring the symbols to Ready state in the target dylib. This runs
+  // emit() for any lazy module that has not been split yet, building the
+  // stubs and lodging the function bodies with the implementation dylib.
+  // Only then can the bodies themselves be requested.
+  ES.lookup(
+      LookupKind::Static,
+      makeJITDylibSearchOrder(&TargetD, JITDylibLookupFlags::MatchAllSymbols),
+      LookupSet, SymbolState::Ready,
+      [this, &ES, &TargetD, LookupSet](Expected<SymbolMap> Result) mutable {
+        if (!Result) {
+          ES.reportError(Result.takeError());
+          return;
+        }
+
+        JITDylib *ImplD = nullptr;
+        {
+          std::lock_guard<std::mutex> Lock(CODLayerMutex);
+          auto I = DylibResources.find(&TargetD);
+          if (I == DylibResources.end())
+            return;
+          ImplD = &I->second.getImplDylib();
+        }
+
+        // Compile the bodies behind the stubs. The names are the same in the
+        // implementation dylib, and symbols that do not name an extractable
+        // definition there are simply skipped.
+        ES.lookup(LookupKind::Static,
+                  makeJITDylibSearchOrder(
+                      ImplD, JITDylibLookupFlags::MatchAllSymbols),
+                  std::move(LookupSet), SymbolState::Ready,
+                  [&ES](Expected<SymbolMap> Result) {
+                    if (!Result)
+                      ES.reportError(Result.takeError());
+                  },
+                  NoDependenciesToRegister);
+      },
+      NoDependenciesToRegister);
+}
 void CompileOnDemandLayer::emit(
     std::unique_ptr<MaterializationResponsibility> R, ThreadSafeModule TSM) {
   assert(TSM && "Null module");
@@ -184,6 +240,7 @@ void CompileOnDemandLayer::emit(
 
 CompileOnDemandLayer::PerDylibResources &
 CompileOnDemandLayer::getPerDylibResources(JITDylib &TargetD) {
+  std::lock_guard<std::mutex> Lock(CODLayerMutex);
   auto I = DylibResources.find(&TargetD);
   if (I == DylibResources.end()) {
     auto &ImplD =
@@ -265,6 +322,10 @@ void CompileOnDemandLayer::emitPartition(
   //        memory manager instance to the linking layer.
 
   auto &ES = getExecutionSession();
+
+  if (NotifyMaterializing)
+    NotifyMaterializing(R->getTargetJITDylib(), R->getRequestedSymbols());
+
   GlobalValueSet RequestedGVs;
   for (auto &Name : R->getRequestedSymbols()) {
     if (Name == R->getInitializerSymbol())
@@ -1107,6 +1107,13 @@ LLJIT::LLJIT(LLJITBuilderState &S, Error &Err)
     ES->setDispatchMaterialization(
         [this](std::unique_ptr<MaterializationUnit> MU,
                std::unique_ptr<MaterializationResponsibility> MR) {
+          // Run units that only manipulate the symbol table inline: queueing
+          // them behind in-flight compiles would hold up resolution of
+          // symbols that are cheap to provide.
+          if (!MU->isExpensiveToMaterialize()) {
+            MU->materialize(std::move(MR));
+            return;
+          }
           // FIXME: We should be able to use move-capture here, but ThreadPool's
           // AsyncTaskTys are std::functions rather than unique_functions
           // (because MSVC's std::packaged_tasks don't support move-only types).
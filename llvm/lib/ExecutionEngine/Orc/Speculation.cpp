@@ -52,6 +52,18 @@ Error Speculator::addSpeculationRuntime(JITDylib &JD,
   }));
 }
 
+// Scope note: this layer reacts at speculation points — the guard loads
+// injected below fire __orc_speculate_for on first entry, and the registered
+// QueryAnalysis decides which callees to queue. A production speculator that
+// walks the whole call graph ahead of execution (e.g. from a
+// ModuleSummaryIndex) with decaying priorities and hit/miss accounting would
+// sit *behind* this instrumentation rather than replace it: the pieces it
+// needs that do not exist yet are a prioritized compile queue in the JIT's
+// dispatcher (today dispatched tasks are unordered) and a feedback channel
+// from stub resolution to score speculation accuracy. The entry-point
+// trigger and per-function guards here are the right interception points
+// for both.
+//
 // If two modules, share the same LLVMContext, different threads must
 // not access them concurrently without locking the associated LLVMContext
 // this implementation follows this contract.
@@ -38,6 +38,17 @@ uint8_t *SectionMemoryManager::allocateCodeSection(uintptr_t Size,
                          Alignment);
 }
 
+// Code-locality notes: sections are bump-allocated out of the free tail of
+// previously mapped blocks (see the FreeMem scan below), so modules loaded
+// through one SectionMemoryManager already pack together; scattering happens
+// when a JIT creates a manager per module, which is a client policy choice.
+// Clients that know their total footprint can densify further by overriding
+// reserveAllocationSpace()/needsToReserveAllocationSpace() to premap one
+// arena — that is also the hook where a hugepage-backed mapping would go,
+// since this file itself must stay portable across everything
+// sys::Memory::allocateMappedMemory supports. Hotness-based placement needs
+// the caller to say what is hot at allocation time; RuntimeDyld allocates
+// per section, and sections do not carry profile data.
 uint8_t *SectionMemoryManager::allocateSection(
     SectionMemoryManager::AllocationPurpose Purpose, uintptr_t Size,
     unsigned Alignment) {
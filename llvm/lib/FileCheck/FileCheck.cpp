@@ -2153,6 +2153,19 @@ static unsigned CountNumNewlinesBetween(StringRef Range,
   }
 }
 
+// A note on scaling, since large generated tests make this the hot loop of
+// check-* runs: plain sequential CHECKs are not a per-directive rescan. Each
+// directive receives the buffer starting at the previous match's end, so a
+// passing file is consumed in one monotone forward pass no matter how many
+// directives it has, and a combined Aho-Corasick prepass over the fixed
+// strings would find the same anchors the individual searches already find
+// without backtracking. The superlinear cases are the bounded rescans —
+// every CHECK-DAG in a group scans the whole group's region, and CHECK-NOT
+// re-examines the span between anchors — plus failure diagnostics
+// (printFuzzyMatch). Tests that are slow to check almost always have large
+// DAG groups, and splitting those with CHECK-LABEL (which partitions the
+// buffer before any matching) is far more effective than a faster string
+// scanner.
 size_t FileCheckString::Check(const SourceMgr &SM, StringRef Buffer,
                               bool IsLabelScanMode, size_t &MatchLen,
                               FileCheckRequest &Req,
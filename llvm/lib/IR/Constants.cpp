@@ -453,6 +453,11 @@ Constant *Constant::getAggregateElement(Constant *Elt) const {
 }
 
 void Constant::destroyConstant() {
+  // The constant folding cache may hold this constant as a key or a value;
+  // drop it wholesale rather than scanning for entries to invalidate.
+  if (!getContext().pImpl->CachedConstantFolds.empty())
+    getContext().pImpl->CachedConstantFolds.clear();
+
   /// First call destroyConstantImpl on the subclass.  This gives the subclass
   /// a chance to remove the constant from any maps/pools it's contained in.
   switch (getValueID()) {
@@ -803,6 +808,22 @@ Constant *Constant::mergeUndefsWith(Constant *C, Constant *Other) {
   return C;
 }
 
+//===----------------------------------------------------------------------===//
+//                                ConstantData
+//===----------------------------------------------------------------------===//
+
+void *ConstantData::operator new(size_t S, BumpPtrAllocator &Alloc) {
+  // Mirrors User::operator new(S, 0): there are no co-allocated uses or
+  // descriptor, but the use-related header fields must be initialized before
+  // the constructor runs.
+  auto *Obj = static_cast<ConstantData *>(
+      Alloc.Allocate(S, alignof(std::max_align_t)));
+  Obj->NumUserOperands = 0;
+  Obj->HasHungOffUses = false;
+  Obj->HasDescriptor = false;
+  return Obj;
+}
+
 //===----------------------------------------------------------------------===//
 //                                ConstantInt
 //===----------------------------------------------------------------------===//
@@ -854,14 +875,14 @@ Constant *ConstantInt::getBool(Type *Ty, bool V) {
 ConstantInt *ConstantInt::get(LLVMContext &Context, const APInt &V) {
   // get an existing value or the insertion position
   LLVMContextImpl *pImpl = Context.pImpl;
-  std::unique_ptr<ConstantInt> &Slot = pImpl->IntConstants[V];
+  ConstantInt *&Slot = pImpl->IntConstants[V];
   if (!Slot) {
     // Get the corresponding integer type for the bit width of the value.
     IntegerType *ITy = IntegerType::get(Context, V.getBitWidth());
-    Slot.reset(new ConstantInt(ITy, V));
+    Slot = new (pImpl->Alloc) ConstantInt(ITy, V);
   }
   assert(Slot->getType() == IntegerType::get(Context, V.getBitWidth()));
-  return Slot.get();
+  return Slot;
 }
 
 Constant *ConstantInt::get(Type *Ty, uint64_t V, bool isSigned) {
@@ -1009,14 +1030,14 @@ Constant *ConstantFP::getZeroValueForNegation(Type *Ty) {
 ConstantFP* ConstantFP::get(LLVMContext &Context, const APFloat& V) {
   LLVMContextImpl* pImpl = Context.pImpl;
 
-  std::unique_ptr<ConstantFP> &Slot = pImpl->FPConstants[V];
+  ConstantFP *&Slot = pImpl->FPConstants[V];
 
   if (!Slot) {
     Type *Ty = Type::getFloatingPointTy(Context, V.getSemantics());
-    Slot.reset(new ConstantFP(Ty, V));
+    Slot = new (pImpl->Alloc) ConstantFP(Ty, V);
   }
 
-  return Slot.get();
+  return Slot;
 }
 
 Constant *ConstantFP::getInfinity(Type *Ty, bool Negative) {
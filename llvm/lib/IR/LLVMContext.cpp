@@ -17,6 +17,7 @@
 #include "llvm/ADT/StringMap.h"
 #include "llvm/ADT/StringRef.h"
 #include "llvm/ADT/Twine.h"
+#include "llvm/IR/DataLayout.h"
 #include "llvm/IR/DiagnosticInfo.h"
 #include "llvm/IR/DiagnosticPrinter.h"
 #include "llvm/IR/LLVMRemarkStreamer.h"
@@ -331,6 +332,29 @@ bool LLVMContext::shouldDiscardValueNames() const {
   return pImpl->DiscardValueNames;
 }
 
+Constant *LLVMContext::getCachedConstantFold(const Constant *C,
+                                             const DataLayout &DL) {
+  // Fold results depend on the data layout; drop the cache when queried with
+  // a different one than it was filled under. Comparing the address first
+  // keeps the common case (every fold in a pass pipeline uses the module's
+  // layout object) to a pointer compare.
+  if (pImpl->CachedConstantFoldsDLPtr != &DL) {
+    if (!pImpl->CachedConstantFoldsDL ||
+        *pImpl->CachedConstantFoldsDL != DL.getStringRepresentation()) {
+      pImpl->CachedConstantFolds.clear();
+      pImpl->CachedConstantFoldsDL = DL.getStringRepresentation();
+    }
+    pImpl->CachedConstantFoldsDLPtr = &DL;
+  }
+  return pImpl->CachedConstantFolds.lookup(C);
+}
+
+void LLVMContext::addCachedConstantFold(const Constant *C, Constant *Folded) {
+  assert(pImpl->CachedConstantFoldsDL &&
+         "must be preceded by a getCachedConstantFold query");
+  pImpl->CachedConstantFolds[C] = Folded;
+}
+
 bool LLVMContext::isODRUniquingDebugTypes() const { return !!pImpl->DITypeMap; }
 
 void LLVMContext::enableDebugTypeODRUniquing() {
@@ -99,7 +99,14 @@ LLVMContextImpl::~LLVMContextImpl() {
   CPNConstants.clear();
   UVConstants.clear();
   PVConstants.clear();
+  // Integer and FP constant nodes live in Alloc; run their destructors by
+  // hand so out-of-line APInt/APFloat storage is freed, then let the
+  // allocator reclaim the nodes themselves in slabs.
+  for (auto &I : IntConstants)
+    I.second->~ConstantInt();
   IntConstants.clear();
+  for (auto &F : FPConstants)
+    F.second->~ConstantFP();
   FPConstants.clear();
   CDSConstants.clear();
 
@@ -52,6 +52,7 @@
 
 namespace llvm {
 
+class DataLayout;
 class StringRef;
 class Type;
 class Value;
@@ -1351,18 +1352,29 @@ public:
   LLVMContext::YieldCallbackTy YieldCallback = nullptr;
   void *YieldOpaqueHandle = nullptr;
 
-  using IntMapTy =
-      DenseMap<APInt, std::unique_ptr<ConstantInt>, DenseMapAPIntKeyInfo>;
+  // The nodes in these two maps are carved out of Alloc and dropped wholesale
+  // with the context; the destructor runs their destructors by hand so that
+  // out-of-line APInt/APFloat storage is released. See
+  // ConstantData::operator new(size_t, BumpPtrAllocator &).
+  using IntMapTy = DenseMap<APInt, ConstantInt *, DenseMapAPIntKeyInfo>;
   IntMapTy IntConstants;
 
-  using FPMapTy =
-      DenseMap<APFloat, std::unique_ptr<ConstantFP>, DenseMapAPFloatKeyInfo>;
+  using FPMapTy = DenseMap<APFloat, ConstantFP *, DenseMapAPFloatKeyInfo>;
   FPMapTy FPConstants;
 
   FoldingSet<AttributeImpl> AttrsSet;
   FoldingSet<AttributeListImpl> AttrsLists;
   FoldingSet<AttributeSetNode> AttrsSetNodes;
 
+  // Note on concurrency: sharding these tables (or making their read path
+  // lock-free) would not be sufficient to let multiple threads build metadata
+  // in one context. Creating an MDString or uniqued MDNode also carves memory
+  // out of Alloc, may resolve forward references by RAUW'ing temporary nodes
+  // (rewriting the operands of already-uniqued nodes and moving them between
+  // these sets), and updates ValuesAsMetadata when values die. All of that
+  // state is shared and unsynchronized by design; the supported pattern for
+  // parallel frontends remains one LLVMContext per thread, with duplicated
+  // metadata deduplicated by IRMover when the modules are linked.
   StringMap<MDString, BumpPtrAllocator> MDStringCache;
   DenseMap<Value *, ValueAsMetadata *> ValuesAsMetadata;
   DenseMap<Metadata *, MetadataAsValue *> MetadataAsValues;
@@ -1408,6 +1420,18 @@ public:
 
   ConstantUniqueMap<ConstantExpr> ExprConstants;
 
+  /// Memoized constant folding results, keyed on the uniqued input constant.
+  /// Only valid for folds performed under CachedConstantFoldsDL; both keys
+  /// and values may dangle once a constant is destroyed, so the map is
+  /// dropped from Constant::destroyConstant().
+  DenseMap<const Constant *, Constant *> CachedConstantFolds;
+
+  /// String representation of the DataLayout the fold cache was filled
+  /// under, and the address it was last queried with as a cheap same-layout
+  /// check. None means the cache has never been filled.
+  Optional<std::string> CachedConstantFoldsDL;
+  const DataLayout *CachedConstantFoldsDLPtr = nullptr;
+
   ConstantUniqueMap<InlineAsm> InlineAsms;
 
   ConstantInt *TheTrueVal = nullptr;
@@ -239,29 +239,34 @@ bool LTOCodeGenerator::writeMergedModules(StringRef Path) {
   // mark which symbols can not be internalized
   applyScopeRestrictions();
 
-  // create output file
+  // Create the output file. Open it for reading and writing so the bitcode
+  // writer can flush the stream incrementally instead of buffering the whole
+  // merged module in memory.
   std::error_code EC;
-  ToolOutputFile Out(Path, EC, sys::fs::OF_None);
+  raw_fd_stream Out(Path, EC);
   if (EC) {
     std::string ErrMsg = "could not open bitcode file for writing: ";
     ErrMsg += Path.str() + ": " + EC.message();
     emitError(ErrMsg);
     return false;
   }
+  sys::RemoveFileOnSignal(Path);
 
   // write bitcode to it
-  WriteBitcodeToFile(*MergedModule, Out.os(), ShouldEmbedUselists);
-  Out.os().close();
+  WriteBitcodeToFile(*MergedModule, Out, ShouldEmbedUselists);
+  Out.close();
 
-  if (Out.os().has_error()) {
+  if (Out.has_error()) {
     std::string ErrMsg = "could not write bitcode file: ";
-    ErrMsg += Path.str() + ": " + Out.os().error().message();
+    ErrMsg += Path.str() + ": " + Out.error().message();
     emitError(ErrMsg);
-    Out.os().clear_error();
+    Out.clear_error();
+    sys::fs::remove(Path);
+    sys::DontRemoveFileOnSignal(Path);
     return false;
   }
 
-  Out.keep();
+  sys::DontRemoveFileOnSignal(Path);
   return true;
 }
 
@@ -816,6 +816,23 @@ MCAssembler::handleFixup(const MCAsmLayout &Layout, MCFragment &F,
   return std::make_tuple(Target, FixedValue, IsResolved);
 }
 
+// Fragment kinds relaxFragment can resize. Keep in sync with its switch.
+static bool canFragmentRelax(const MCFragment &F) {
+  switch (F.getKind()) {
+  default:
+    return false;
+  case MCFragment::FT_Relaxable:
+  case MCFragment::FT_Dwarf:
+  case MCFragment::FT_DwarfFrame:
+  case MCFragment::FT_LEB:
+  case MCFragment::FT_BoundaryAlign:
+  case MCFragment::FT_CVInlineLines:
+  case MCFragment::FT_CVDefRange:
+  case MCFragment::FT_PseudoProbe:
+    return true;
+  }
+}
+
 void MCAssembler::layout(MCAsmLayout &Layout) {
   assert(getBackendPtr() && "Expected assembler backend");
   DEBUG_WITH_TYPE("mc-dump", {
@@ -843,8 +860,23 @@ void MCAssembler::layout(MCAsmLayout &Layout) {
       Frag.setLayoutOrder(FragmentIndex++);
   }
 
+  // Gather, per section and in section order, the fragments whose size can
+  // change during relaxation. Relaxation rewrites fragment contents but never
+  // adds, removes, or re-kinds fragments, so this scan happens once; the
+  // fixpoint below then skips the data fragments that dominate most sections
+  // on every pass.
+  SmallVector<SmallVector<MCFragment *, 0>, 8> RelaxableFrags;
+  for (MCSection &Sec : *this) {
+    SmallVector<MCFragment *, 0> Frags;
+    for (MCFragment &Frag : Sec)
+      if (canFragmentRelax(Frag))
+        Frags.push_back(&Frag);
+    if (!Frags.empty())
+      RelaxableFrags.push_back(std::move(Frags));
+  }
+
   // Layout until everything fits.
-  while (layoutOnce(Layout)) {
+  while (layoutOnce(Layout, RelaxableFrags)) {
     if (getContext().hadError())
       return;
     // Size of fragments in one section can depend on the size of fragments in
@@ -1229,19 +1261,20 @@ bool MCAssembler::relaxFragment(MCAsmLayout &Layout, MCFragment &F) {
   }
 }
 
-bool MCAssembler::layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec) {
+bool MCAssembler::layoutSectionOnce(MCAsmLayout &Layout,
+                                    ArrayRef<MCFragment *> Frags) {
   // Holds the first fragment which needed relaxing during this layout. It will
   // remain NULL if none were relaxed.
   // When a fragment is relaxed, all the fragments following it should get
   // invalidated because their offset is going to change.
   MCFragment *FirstRelaxedFragment = nullptr;
 
-  // Attempt to relax all the fragments in the section.
-  for (MCFragment &Frag : Sec) {
+  // Attempt to relax all the relaxable fragments in the section.
+  for (MCFragment *Frag : Frags) {
     // Check if this is a fragment that needs relaxation.
-    bool RelaxedFrag = relaxFragment(Layout, Frag);
+    bool RelaxedFrag = relaxFragment(Layout, *Frag);
     if (RelaxedFrag && !FirstRelaxedFragment)
-      FirstRelaxedFragment = &Frag;
+      FirstRelaxedFragment = Frag;
   }
   if (FirstRelaxedFragment) {
     Layout.invalidateFragmentsFrom(FirstRelaxedFragment);
@@ -1250,12 +1283,14 @@ bool MCAssembler::layoutSectionOnce(MCAsmLayout &Layout, MCSection &Sec) {
   return false;
 }
 
-bool MCAssembler::layoutOnce(MCAsmLayout &Layout) {
+bool MCAssembler::layoutOnce(MCAsmLayout &Layout,
+                             ArrayRef<SmallVector<MCFragment *, 0>>
+                                 RelaxableFrags) {
   ++stats::RelaxationSteps;
 
   bool WasRelaxed = false;
-  for (MCSection &Sec : *this) {
-    while (layoutSectionOnce(Layout, Sec))
+  for (const SmallVector<MCFragment *, 0> &Frags : RelaxableFrags) {
+    while (layoutSectionOnce(Layout, Frags))
       WasRelaxed = true;
   }
 
@@ -13,6 +13,7 @@
 #include "llvm/BinaryFormat/COFF.h"
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/MathExtras.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/raw_ostream.h"
 #include <cassert>
 #include <cstddef>
@@ -124,6 +125,42 @@ tailcall:
   }
 }
 
+// Sort the strings for suffix merging. Large tables are pre-partitioned by
+// their last character so the resulting buckets can be sorted concurrently.
+// The buckets are reassembled in the descending character order multikeySort
+// itself produces, and since the table never contains duplicate strings that
+// order is strict, so the result - and thus the output file - is identical to
+// a serial sort.
+static void sortStrings(std::vector<StringPair *> &Strings) {
+  // Below this size the bucketing pass tends to cost more than it saves.
+  if (Strings.size() < 16384) {
+    multikeySort(Strings, 0);
+    return;
+  }
+
+  std::vector<StringPair *> Buckets[256];
+  std::vector<StringPair *> Empty;
+  for (StringPair *P : Strings) {
+    StringRef S = P->first.val();
+    if (S.empty())
+      Empty.push_back(P);
+    else
+      Buckets[(unsigned char)S.back()].push_back(P);
+  }
+
+  parallelForEachN(0, 256, [&Buckets](size_t I) {
+    multikeySort(Buckets[I], /*Pos=*/1);
+  });
+
+  size_t Idx = 0;
+  for (int C = 255; C >= 0; --C)
+    for (StringPair *P : Buckets[C])
+      Strings[Idx++] = P;
+  for (StringPair *P : Empty)
+    Strings[Idx++] = P;
+  assert(Idx == Strings.size() && "sharded sort lost strings");
+}
+
 void StringTableBuilder::finalize() {
   assert(K != DWARF);
   finalizeStringTable(/*Optimize=*/true);
@@ -142,7 +179,7 @@ void StringTableBuilder::finalizeStringTable(bool Optimize) {
     for (StringPair &P : StringIndexMap)
       Strings.push_back(&P);
 
-    multikeySort(Strings, 0);
+    sortStrings(Strings);
     initSize();
 
     StringRef Previous;
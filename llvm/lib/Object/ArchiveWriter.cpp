@@ -25,6 +25,7 @@
 #include "llvm/Support/Errc.h"
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/Format.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/SmallVectorMemoryBuffer.h"
 #include "llvm/Support/ToolOutputFile.h"
@@ -470,6 +471,43 @@ computeMemberData(raw_ostream &StringTable, raw_ostream &SymNames,
       Entry.second = Entry.second > 1 ? 1 : 0;
   }
 
+  // Extract member symbols up front, in parallel. Each worker parses its
+  // member (with its own LLVMContext for bitcode) and writes names into a
+  // private buffer with buffer-relative offsets; the serial loop below
+  // splices the buffers into SymNames in member order, so the output is
+  // byte-for-byte what a serial extraction produces.
+  struct MemberSymbols {
+    std::vector<unsigned> Offsets;
+    SmallString<0> Names;
+    bool HasObject = false;
+  };
+  std::vector<MemberSymbols> SymBufs;
+  if (NeedSymbols) {
+    SymBufs.resize(NewMembers.size());
+    std::vector<std::unique_ptr<Error>> Errs(NewMembers.size());
+    parallelForEachN(0, NewMembers.size(), [&](size_t I) {
+      MemberSymbols &MS = SymBufs[I];
+      raw_svector_ostream Names(MS.Names);
+      Expected<std::vector<unsigned>> SymbolsOrErr =
+          getSymbols(NewMembers[I].Buf->getMemBufferRef(), Names,
+                     MS.HasObject);
+      if (SymbolsOrErr)
+        MS.Offsets = std::move(*SymbolsOrErr);
+      else
+        Errs[I] = std::make_unique<Error>(SymbolsOrErr.takeError());
+    });
+    // Report the first failing member, as a serial scan would.
+    for (size_t I = 0, E = Errs.size(); I != E; ++I) {
+      if (!Errs[I])
+        continue;
+      for (size_t J = I + 1; J != E; ++J)
+        if (Errs[J])
+          consumeError(std::move(*Errs[J]));
+      return std::move(*Errs[I]);
+    }
+  }
+
+  size_t MemberIndex = 0;
   for (const NewArchiveMember &M : NewMembers) {
     std::string Header;
     raw_string_ostream Out(Header);
@@ -508,12 +546,17 @@ computeMemberData(raw_ostream &StringTable, raw_ostream &SymNames,
 
     std::vector<unsigned> Symbols;
     if (NeedSymbols) {
-      Expected<std::vector<unsigned>> SymbolsOrErr =
-          getSymbols(Buf, SymNames, HasObject);
-      if (auto E = SymbolsOrErr.takeError())
-        return std::move(E);
-      Symbols = std::move(*SymbolsOrErr);
+      // Splice this member's pre-extracted names into the shared name table,
+      // rebasing the worker's buffer-relative offsets.
+      MemberSymbols &MS = SymBufs[MemberIndex];
+      unsigned Base = SymNames.tell();
+      Symbols = std::move(MS.Offsets);
+      for (unsigned &Off : Symbols)
+        Off += Base;
+      SymNames << MS.Names;
+      HasObject |= MS.HasObject;
     }
+    ++MemberIndex;
 
     Pos += Header.size() + Data.size() + Padding.size();
     Ret.push_back({std::move(Symbols), std::move(Header), Data, Padding});
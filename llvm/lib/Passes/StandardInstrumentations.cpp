@@ -23,6 +23,7 @@
 #include "llvm/IR/Module.h"
 #include "llvm/IR/PassInstrumentation.h"
 #include "llvm/IR/PrintPasses.h"
+#include "llvm/IR/StructuralHash.h"
 #include "llvm/IR/Verifier.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
@@ -41,6 +42,16 @@ cl::opt<bool> PreservedCFGCheckerInstrumentation::VerifyPreservedCFG(
     cl::init(false));
 #endif
 
+// An option that skips the run of a function pass when the function hashes
+// identically to the last run of the same pass that made no changes to it.
+// The structural hash ignores operands, and passes may consult state outside
+// the function body, so the cache trades a small amount of precision for
+// compile time; it is off by default.
+static cl::opt<bool> SkipUnchangedFunctionPasses(
+    "skip-unchanged-function-passes", cl::Hidden, cl::init(false),
+    cl::desc("Skip function passes whose previous run made no changes to a "
+             "function that is structurally unchanged since"));
+
 // FIXME: Change `-debug-pass-manager` from boolean to enum type. Similar to
 // `-debug-pass` in legacy PM.
 static cl::opt<bool>
@@ -643,6 +654,81 @@ void OptBisectInstrumentation::registerCallbacks(
   });
 }
 
+void SkipUnchangedInstrumentation::functionDeleted(Value *F) {
+  SmallVector<std::pair<StringRef, const Function *>, 4> DeadKeys;
+  for (const auto &Entry : NoChangeHash)
+    if (Entry.first.second == F)
+      DeadKeys.push_back(Entry.first);
+  for (const auto &Key : DeadKeys)
+    NoChangeHash.erase(Key);
+  // The watcher itself stays in the map with a nulled handle; it is re-armed
+  // if a later function is allocated at the same address.
+}
+
+bool SkipUnchangedInstrumentation::shouldRun(StringRef PassID, Any IR) {
+  if (!any_isa<const Function *>(IR))
+    return true;
+  const Function *F = any_cast<const Function *>(IR);
+  auto It = NoChangeHash.find(std::make_pair(PassID, F));
+  if (It == NoChangeHash.end() || It->second != StructuralHash(*F))
+    return true;
+  if (DebugLogging)
+    dbgs() << "Skipping pass " << PassID << " on " << F->getName()
+           << ": made no changes when last run on this function\n";
+  return false;
+}
+
+void SkipUnchangedInstrumentation::registerCallbacks(
+    PassInstrumentationCallbacks &PIC) {
+  if (!SkipUnchangedFunctionPasses)
+    return;
+
+  PIC.registerShouldRunOptionalPassCallback(
+      [this](StringRef P, Any IR) { return this->shouldRun(P, IR); });
+
+  PIC.registerBeforeNonSkippedPassCallback([this](StringRef P, Any IR) {
+    if (any_isa<const Function *>(IR)) {
+      const Function *F = any_cast<const Function *>(IR);
+      HashStackBefore.emplace_back(P, std::make_pair(F, StructuralHash(*F)));
+    } else
+      HashStackBefore.emplace_back(P, None);
+  });
+
+  PIC.registerAfterPassInvalidatedCallback(
+      [this](StringRef P, const PreservedAnalyses &) {
+        auto Before = HashStackBefore.pop_back_val();
+        assert(Before.first == P &&
+               "Before and After callbacks must correspond");
+        (void)Before;
+      });
+
+  PIC.registerAfterPassCallback(
+      [this](StringRef P, Any IR, const PreservedAnalyses &) {
+        auto Before = HashStackBefore.pop_back_val();
+        assert(Before.first == P &&
+               "Before and After callbacks must correspond");
+        if (!Before.second)
+          return;
+
+        // Remember the hash only when the pass left the function unchanged;
+        // a pass that did change it invalidates whatever we knew about it.
+        const Function *F = Before.second->first;
+        uint64_t HashAfter = StructuralHash(*F);
+        if (HashAfter == Before.second->second) {
+          NoChangeHash[std::make_pair(P, F)] = HashAfter;
+          // Watch for F's deletion so the entry cannot outlive it and be
+          // inherited by an unrelated function at the same address. A
+          // watcher left over from a prior occupant of the address has a
+          // nulled handle and is re-armed here.
+          std::unique_ptr<FunctionWatcher> &Watcher = Watchers[F];
+          if (!Watcher || !static_cast<Value *>(*Watcher))
+            Watcher = std::make_unique<FunctionWatcher>(
+                this, const_cast<Function *>(F));
+        } else
+          NoChangeHash.erase(std::make_pair(P, F));
+      });
+}
+
 void PrintPassInstrumentation::registerCallbacks(
     PassInstrumentationCallbacks &PIC) {
   if (!DebugLogging)
@@ -870,6 +956,7 @@ void VerifyInstrumentation::registerCallbacks(
 StandardInstrumentations::StandardInstrumentations(bool DebugLogging,
                                                    bool VerifyEach)
     : PrintPass(DebugLogging), OptNone(DebugLogging),
+      SkipUnchanged(DebugLogging),
       PrintChangedIR(PrintChanged != PrintChangedQuiet), Verify(DebugLogging),
       VerifyEach(VerifyEach) {}
 
@@ -880,6 +967,7 @@ void StandardInstrumentations::registerCallbacks(
   TimePasses.registerCallbacks(PIC);
   OptNone.registerCallbacks(PIC);
   OptBisect.registerCallbacks(PIC);
+  SkipUnchanged.registerCallbacks(PIC);
   PreservedCFGChecker.registerCallbacks(PIC);
   PrintChangedIR.registerCallbacks(PIC);
   PseudoProbeVerification.registerCallbacks(PIC);
@@ -899,7 +899,7 @@ Error IndexedInstrProfReader::getFunctionCounts(StringRef FuncName,
   if (Error E = Record.takeError())
     return error(std::move(E));
 
-  Counts = Record.get().Counts;
+  Counts = std::move(Record.get().Counts);
   return success();
 }
 
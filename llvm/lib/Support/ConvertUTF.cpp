@@ -50,6 +50,8 @@
 #include <stdio.h>
 #endif
 #include <assert.h>
+#include <stdint.h>
+#include <string.h>
 
 /*
  * This code extensively uses fall-through switches.
@@ -522,13 +524,36 @@ unsigned getNumBytesForUTF8(UTF8 first) {
 
 /* --------------------------------------------------------------------- */
 
+/*
+ * Skips over a leading run of ASCII bytes, a word at a time. Real-world
+ * strings handed to the validation and conversion routines are mostly
+ * ASCII with occasional multi-byte sequences, so this cheaply disposes
+ * of the common bytes before the per-code-point state machine runs.
+ */
+static const UTF8 *skipASCII(const UTF8 *source, const UTF8 *sourceEnd) {
+    while (sourceEnd - source >= 8) {
+        uint64_t chunk;
+        memcpy(&chunk, source, 8);
+        if (chunk & UINT64_C(0x8080808080808080))
+            break;
+        source += 8;
+    }
+    while (source != sourceEnd && *source < 0x80)
+        ++source;
+    return source;
+}
+
 /*
  * Exported function to return whether a UTF-8 string is legal or not.
  * This is not used here; it's just exported.
  */
 Boolean isLegalUTF8String(const UTF8 **source, const UTF8 *sourceEnd) {
     while (*source != sourceEnd) {
-        int length = trailingBytesForUTF8[**source] + 1;
+        int length;
+        *source = skipASCII(*source, sourceEnd);
+        if (*source == sourceEnd)
+            break;
+        length = trailingBytesForUTF8[**source] + 1;
         if (length > sourceEnd - *source || !isLegalUTF8(*source, length))
             return false;
         *source += length;
@@ -546,7 +571,19 @@ ConversionResult ConvertUTF8toUTF16 (
     UTF16* target = *targetStart;
     while (source < sourceEnd) {
         UTF32 ch = 0;
-        unsigned short extraBytesToRead = trailingBytesForUTF8[*source];
+        unsigned short extraBytesToRead;
+        if (*source < 0x80) {
+            /* ASCII run: no validation or surrogate logic needed, only
+               zero-extension. */
+            const UTF8* runEnd = skipASCII(source, sourceEnd);
+            while (source < runEnd && target < targetEnd)
+                *target++ = (UTF16)*source++;
+            if (source < runEnd) {
+                result = targetExhausted; break;
+            }
+            continue;
+        }
+        extraBytesToRead = trailingBytesForUTF8[*source];
         if (extraBytesToRead >= sourceEnd - source) {
             result = sourceExhausted; break;
         }
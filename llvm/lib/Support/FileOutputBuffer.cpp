@@ -47,6 +47,15 @@ public:
 
   Error commit() override {
     // Unmap buffer, letting OS flush dirty pages to file on disk.
+    //
+    // Note that because the buffer is a memory mapping, writeback of dirty
+    // pages overlaps with the client's remaining work from the moment the
+    // pages are written; the kernel does not wait for this unmap to start
+    // flushing. An explicit range-by-range async flush API has been
+    // considered and dropped: clients like linkers have no point at which a
+    // byte range is final (relocation, build-id hashing, and checksum passes
+    // revisit earlier ranges), and O_DIRECT is incompatible with writing
+    // through a shared mapping.
     Buffer.reset();
 
     // Atomically replace the existing file with the new one.
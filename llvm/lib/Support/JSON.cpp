@@ -519,16 +519,21 @@ bool Parser::parseNumber(char First, Value &Out) {
 
 bool Parser::parseString(std::string &Out) {
   // leading quote was already consumed.
-  for (char C = next(); C != '"'; C = next()) {
+  for (;;) {
+    // Bulk-copy the longest run of plain characters. Most strings contain no
+    // escapes, so this is usually everything up to the closing quote.
+    const char *Run = P;
+    while (P != End && *P != '"' && *P != '\\' && (*P & 0x1f) != *P)
+      ++P;
+    Out.append(Run, P);
+    char C = next();
+    if (C == '"')
+      break;
     if (LLVM_UNLIKELY(P == End))
       return parseError("Unterminated string");
     if (LLVM_UNLIKELY((C & 0x1f) == C))
       return parseError("Control character in string");
-    if (LLVM_LIKELY(C != '\\')) {
-      Out.push_back(C);
-      continue;
-    }
-    // Handle escape sequence.
+    // C must be a backslash here; handle the escape sequence.
     switch (C = next()) {
     case '"':
     case '\\':
@@ -218,6 +218,8 @@ public:
   MemoryBuffer::BufferKind getBufferKind() const override {
     return MemoryBuffer::MemoryBuffer_MMap;
   }
+
+  void dontNeedIfMmapped() override { MFR.dontNeed(); }
 };
 }
 
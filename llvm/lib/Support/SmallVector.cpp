@@ -98,6 +98,19 @@ static size_t getNewCapacity(size_t MinSize, size_t TSize, size_t OldCapacity) {
   return std::min(std::max(NewCapacity, MinSize), MaxSize);
 }
 
+// On routing these spills through a pooled scratch allocator instead of
+// malloc: SmallVector deliberately has no allocator parameter — its identity
+// (and its use in vararg-adjacent ABIs via SmallVectorImpl&) depends on every
+// instantiation sharing this one grow path, and threading an allocator
+// through would change the type of every SmallVectorImpl& interface in the
+// tree. The supported pattern for allocation-churn-sensitive pass temporaries
+// is the other way around: size the inline capacity so the hot case never
+// spills (the usual fix when heap profiles flag a particular worklist), or
+// keep a long-lived container/BumpPtrAllocator in the pass object and clear()
+// it per function, which recycles the peak allocation across runs. Both are
+// local decisions at the use site, which is where the lifetime knowledge
+// lives.
+//
 // Note: Moving this function into the header may cause performance regression.
 template <class Size_T>
 void *SmallVectorBase<Size_T>::mallocForGrow(size_t MinSize, size_t TSize,
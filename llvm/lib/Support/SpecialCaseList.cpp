@@ -58,6 +58,15 @@ bool SpecialCaseList::Matcher::insert(std::string Regexp,
   return true;
 }
 
+// Matching is tiered to keep the backtracking regex engine off the hot path:
+// literal patterns are served from an exact-match StringMap, and non-literal
+// patterns sit behind a trigram prefilter that rejects most queries without
+// running any regex. Only queries that share three-character substrings with
+// some pattern reach llvm_regexec, and each pattern is compiled separately
+// rather than as one giant alternation, so a miss on one pattern does not
+// backtrack through the others. A lazy-DFA engine would only help workloads
+// that defeat the trigram index (patterns full of wildcards), at the cost of
+// a second regex implementation to maintain.
 unsigned SpecialCaseList::Matcher::match(StringRef Query) const {
   auto It = Strings.find(Query);
   if (It != Strings.end())
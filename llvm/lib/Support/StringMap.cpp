@@ -71,6 +71,14 @@ void StringMapImpl::init(unsigned InitSize) {
 /// specified bucket will be non-null.  Otherwise, it will be null.  In either
 /// case, the FullHashValue field of the bucket will be set to the hash value
 /// of the string.
+///
+/// The layout already memoizes hashes: HashTable is a side array of full hash
+/// values parallel to the bucket pointers, so probing touches only that array
+/// and the pointer slots (cache-dense, no entry dereference), a key compare
+/// only happens after a full 32-bit hash match, and RehashTable redistributes
+/// entries from the stored hashes without ever rehashing a string.  The deep
+/// compare below is a single length-checked memcmp via StringRef, which the
+/// libc vectorizes.
 unsigned StringMapImpl::LookupBucketFor(StringRef Name) {
   unsigned HTSize = NumBuckets;
   if (HTSize == 0) { // Hash table unallocated so far?
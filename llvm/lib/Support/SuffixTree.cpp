@@ -16,6 +16,17 @@
 
 using namespace llvm;
 
+// Construction is Ukkonen's algorithm: linear time, single-threaded, with
+// nodes placed in a SpecificBumpPtrAllocator (the only per-node heap traffic
+// left is each node's DenseMap of children, which the unbounded alphabet —
+// instruction-mapping integers, not bytes — makes hard to flatten). A suffix
+// array plus LCP array (SA-IS) would be flat and more cache-friendly, and
+// could in principle be built in parallel, but the repeated-substring
+// iterator below walks the tree's internal-node/leaf-children structure
+// directly; swapping the backing store means re-deriving that enumeration
+// from LCP intervals and re-validating the outliner's candidate set against
+// it, so it would land as a parallel implementation behind this interface,
+// not as a rewrite of this file.
 SuffixTree::SuffixTree(const std::vector<unsigned> &Str) : Str(Str) {
   Root = insertInternalNode(nullptr, EmptyIdx, EmptyIdx, 0);
   Active.Node = Root;
@@ -22,6 +22,12 @@ using namespace llvm;
 
 ThreadPool::ThreadPool(ThreadPoolStrategy S)
     : ThreadCount(S.compute_thread_count()) {
+  // One task deque per worker; each is created up front so that asyncImpl
+  // and the steal loop can index them without synchronization.
+  WorkerQueues.reserve(ThreadCount);
+  for (unsigned I = 0; I < ThreadCount; ++I)
+    WorkerQueues.push_back(std::make_unique<WorkerQueue>());
+
   // Create ThreadCount threads that will loop forever, wait on QueueCondition
   // for tasks to be queued or the Pool to be destroyed.
   Threads.reserve(ThreadCount);
@@ -30,22 +36,19 @@ ThreadPool::ThreadPool(ThreadPoolStrategy S)
       S.apply_thread_strategy(ThreadID);
       while (true) {
         PackagedTaskTy Task;
-        {
+        if (!tryPopTask(ThreadID, Task)) {
           std::unique_lock<std::mutex> LockGuard(QueueLock);
-          // Wait for tasks to be pushed in the queue
-          QueueCondition.wait(LockGuard,
-                              [&] { return !EnableFlag || !Tasks.empty(); });
+          // Wait for tasks to be pushed in a queue. QueuedTasks may be
+          // raised before the task is visible in its deque, in which case we
+          // simply go around the loop once more.
+          QueueCondition.wait(LockGuard, [&] {
+            return !EnableFlag ||
+                   QueuedTasks.load(std::memory_order_acquire) != 0;
+          });
           // Exit condition
-          if (!EnableFlag && Tasks.empty())
+          if (!EnableFlag && QueuedTasks.load(std::memory_order_acquire) == 0)
             return;
-          // Yeah, we have a task, grab it and release the lock on the queue
-
-          // We first need to signal that we are active before popping the queue
-          // in order for wait() to properly detect that even if the queue is
-          // empty, there is still a task in flight.
-          ++ActiveThreads;
-          Task = std::move(Tasks.front());
-          Tasks.pop();
+          continue;
         }
         // Run the task we just grabbed
         Task();
@@ -66,6 +69,49 @@ ThreadPool::ThreadPool(ThreadPoolStrategy S)
   }
 }
 
+bool ThreadPool::tryPopTask(unsigned ThreadID, PackagedTaskTy &Task) {
+  // Cheap exit when every queue is drained; avoids touching any lock.
+  if (QueuedTasks.load(std::memory_order_acquire) == 0)
+    return false;
+
+  auto PopFrom = [&](WorkerQueue &Queue, bool FromBack) {
+    std::lock_guard<std::mutex> LockGuard(Queue.Lock);
+    if (Queue.Tasks.empty())
+      return false;
+    {
+      // Transfer the task from queued to active under QueueLock, the lock
+      // wait() evaluates its predicate under. Updating the two counters
+      // without it would let a waiter read ActiveThreads before the
+      // increment and QueuedTasks after the decrement and so observe an
+      // in-flight task as completed. Queue.Lock is never acquired with
+      // QueueLock held, so taking QueueLock here cannot deadlock.
+      std::lock_guard<std::mutex> PoolLockGuard(QueueLock);
+      ++ActiveThreads;
+      QueuedTasks.fetch_sub(1, std::memory_order_release);
+    }
+    if (FromBack) {
+      Task = std::move(Queue.Tasks.back());
+      Queue.Tasks.pop_back();
+    } else {
+      Task = std::move(Queue.Tasks.front());
+      Queue.Tasks.pop_front();
+    }
+    return true;
+  };
+
+  // Prefer our own queue, newest task first.
+  if (PopFrom(*WorkerQueues[ThreadID], /*FromBack=*/true))
+    return true;
+
+  // Steal the oldest task from a sibling, starting just past our own queue
+  // so that concurrent thieves fan out over different victims.
+  for (unsigned I = 1; I < ThreadCount; ++I)
+    if (PopFrom(*WorkerQueues[(ThreadID + I) % ThreadCount],
+                /*FromBack=*/false))
+      return true;
+  return false;
+}
+
 void ThreadPool::wait() {
   // Wait for all threads to complete and the queue to be empty
   std::unique_lock<std::mutex> LockGuard(QueueLock);
@@ -76,14 +122,28 @@ std::shared_future<void> ThreadPool::asyncImpl(TaskTy Task) {
   /// Wrap the Task in a packaged_task to return a future object.
   PackagedTaskTy PackagedTask(std::move(Task));
   auto Future = PackagedTask.get_future();
-  {
-    // Lock the queue and push the new task
-    std::unique_lock<std::mutex> LockGuard(QueueLock);
 
-    // Don't allow enqueueing after disabling the pool
-    assert(EnableFlag && "Queuing a thread during ThreadPool destruction");
+  // Don't allow enqueueing after disabling the pool
+  assert(EnableFlag && "Queuing a thread during ThreadPool destruction");
 
-    Tasks.push(std::move(PackagedTask));
+  // Distribute tasks over the per-worker queues round-robin; only the queue
+  // we touch is locked. The queued count is raised before the push so a
+  // thief can never pop a task that is not yet accounted for.
+  WorkerQueue &Queue =
+      *WorkerQueues[NextQueue.fetch_add(1, std::memory_order_relaxed) %
+                    ThreadCount];
+  {
+    // Raise the count under QueueLock, the mutex the workers' wait predicate
+    // reads it under. Incrementing outside the lock could land between an
+    // idle worker's (false) predicate evaluation and it blocking on
+    // QueueCondition, in which case the notify below is dropped and the task
+    // sits unserved in its queue.
+    std::lock_guard<std::mutex> LockGuard(QueueLock);
+    QueuedTasks.fetch_add(1, std::memory_order_release);
+  }
+  {
+    std::lock_guard<std::mutex> LockGuard(Queue.Lock);
+    Queue.Tasks.push_back(std::move(PackagedTask));
   }
   QueueCondition.notify_one();
   return Future.share();
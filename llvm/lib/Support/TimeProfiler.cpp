@@ -47,10 +47,12 @@ typedef std::pair<std::string, CountAndDurationType>
 
 namespace {
 struct Entry {
-  const TimePointType Start;
+  // Not const so that a finished Entry can be moved from the scope stack into
+  // the event list without copying the name and detail strings.
+  TimePointType Start;
   TimePointType End;
-  const std::string Name;
-  const std::string Detail;
+  std::string Name;
+  std::string Detail;
 
   Entry(TimePointType &&S, TimePointType &&E, std::string &&N, std::string &&Dt)
       : Start(std::move(S)), End(std::move(E)), Name(std::move(N)),
@@ -101,10 +103,6 @@ struct llvm::TimeTraceProfiler {
     // Calculate duration at full precision for overall counts.
     DurationType Duration = E.End - E.Start;
 
-    // Only include sections longer or equal to TimeTraceGranularity msec.
-    if (duration_cast<microseconds>(Duration).count() >= TimeTraceGranularity)
-      Entries.emplace_back(E);
-
     // Track total time taken by each "name", but only the topmost levels of
     // them; e.g. if there's a template instantiation that instantiates other
     // templates from within, we only want to add the topmost one. "topmost"
@@ -118,6 +116,11 @@ struct llvm::TimeTraceProfiler {
       CountAndTotal.second += Duration;
     }
 
+    // Only include sections longer or equal to TimeTraceGranularity msec.
+    // Moving the entry invalidates E, so this must come last.
+    if (duration_cast<microseconds>(Duration).count() >= TimeTraceGranularity)
+      Entries.emplace_back(std::move(E));
+
     Stack.pop_back();
   }
 
@@ -396,6 +396,17 @@ void Input::reportWarning(const SMRange &range, const Twine &message) {
   Strm->printError(range, message, SourceMgr::DK_Warning);
 }
 
+// Input materializes each document twice: the yaml::Stream lexes into a Node
+// graph, and this function wraps it in HNodes (copying scalars that needed
+// unescaping into StringAllocator). A streaming path for homogeneous
+// sequences — feeding parser events straight into the destination vector —
+// would have to bypass both layers, but the trait interface is pull-based:
+// mapping/ScalarTraits callbacks expect random access to sibling keys (e.g.
+// mapOptional lookup order differs from document order), which is exactly
+// what the HNode graph provides. Only a new push-based trait kind could drop
+// it. Multi-document streams cannot be parsed in parallel either: document
+// boundaries are discovered by the lexer, and the SourceMgr-based error
+// plumbing and anchor/alias map are per-Stream state.
 std::unique_ptr<Input::HNode> Input::createHNodes(Node *N) {
   SmallString<128> StringStorage;
   if (ScalarNode *SN = dyn_cast<ScalarNode>(N)) {
@@ -83,6 +83,15 @@ static int createDependencyFile(const TGParser &Parser, const char *argv0) {
   return 0;
 }
 
+// One parse, one backend, one thread. Record evaluation is inherently
+// ordered - late defs can shadow and multiclass instantiation is sequenced
+// by the parser - so independent "record subsets" are only knowable after
+// the full parse that dominates runtime anyway. Incrementality across
+// invocations lives in the build system: each output depends on exactly the
+// .td files reported through the depfile written below, so a one-line .td
+// change re-runs only the affected backends. A finer-grained cache of
+// resolved records would have to be invalidated on any textual change to
+// any included file, which is the same key the depfile already uses.
 int llvm::TableGenMain(const char *argv0, TableGenMainFn *MainFn) {
   RecordKeeper Records;
 
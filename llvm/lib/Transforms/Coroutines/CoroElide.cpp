@@ -201,6 +201,17 @@ bool Lowerer::hasEscapePath(const CoroBeginInst *CB,
   return false;
 }
 
+// Elision is necessarily a post-inline, same-module analysis. To put the
+// frame on the caller's stack we must (a) see every path from coro.begin to
+// function exit pass through a coro.destroy of that exact SSA value, and
+// (b) know the concrete frame size/alignment, which only exists once the
+// callee's llvm.coro.id.* intrinsics and outlined resume/destroy functions
+// are visible here. A summary bit like "frame does not escape" could travel
+// across ThinLTO modules, but it would not be enough: without the callee's
+// body in this module there is no coro.destroy on the caller's paths to
+// anchor (a), and no frame geometry for (b) — so the practical way to get
+// cross-module elision is to import the coroutine ramp for inlining, at
+// which point this analysis applies unchanged.
 bool Lowerer::shouldElide(Function *F, DominatorTree &DT) const {
   // If no CoroAllocs, we cannot suppress allocation, so elision is not
   // possible.
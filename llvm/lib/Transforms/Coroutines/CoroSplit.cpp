@@ -29,6 +29,7 @@
 #include "llvm/Analysis/CallGraph.h"
 #include "llvm/Analysis/CallGraphSCCPass.h"
 #include "llvm/Analysis/LazyCallGraph.h"
+#include "llvm/Analysis/OptimizationRemarkEmitter.h"
 #include "llvm/IR/Argument.h"
 #include "llvm/IR/Attributes.h"
 #include "llvm/IR/BasicBlock.h"
@@ -1714,6 +1715,22 @@ namespace {
   };
 }
 
+/// Report the frame layout chosen for a split coroutine so that frame-size
+/// regressions are visible via -Rpass=coro-split or serialized remarks; for
+/// code that keeps many frames live concurrently, frame size is resident
+/// memory.
+static void reportFrameSize(Function &F, const coro::Shape &Shape,
+                            OptimizationRemarkEmitter &ORE) {
+  if (!Shape.CoroBegin || Shape.CoroSuspends.empty())
+    return;
+  ORE.emit([&]() {
+    return OptimizationRemark(DEBUG_TYPE, "CoroSplit", &F)
+           << "Split '" << ore::NV("function", F.getName())
+           << "' (frame_size=" << ore::NV("frame_size", Shape.FrameSize)
+           << ", align=" << ore::NV("align", Shape.FrameAlign.value()) << ")";
+  });
+}
+
 static coro::Shape splitCoroutine(Function &F,
                                   SmallVectorImpl<Function *> &Clones,
                                   bool ReuseFrameSlot) {
@@ -2063,6 +2080,8 @@ PreservedAnalyses CoroSplitPass::run(LazyCallGraph::SCC &C,
 
     SmallVector<Function *, 4> Clones;
     const coro::Shape Shape = splitCoroutine(F, Clones, ReuseFrameSlot);
+    auto &ORE = FAM.getResult<OptimizationRemarkEmitterAnalysis>(F);
+    reportFrameSize(F, Shape, ORE);
     updateCallGraphAfterCoroutineSplit(*N, Shape, Clones, C, CG, AM, UR, FAM);
 
     if ((Shape.ABI == coro::ABI::Async || Shape.ABI == coro::ABI::Retcon ||
@@ -2162,6 +2181,10 @@ struct CoroSplitLegacy : public CallGraphSCCPass {
 
       SmallVector<Function *, 4> Clones;
       const coro::Shape Shape = splitCoroutine(*F, Clones, ReuseFrameSlot);
+      // The legacy CGSCC pass cannot keep an OptimizationRemarkEmitter
+      // analysis alive across function transformations; build one locally.
+      OptimizationRemarkEmitter ORE(F);
+      reportFrameSize(*F, Shape, ORE);
       updateCallGraphAfterCoroutineSplit(*F, Shape, Clones, CG, SCC);
       if (Shape.ABI == coro::ABI::Async) {
         // Restart SCC passes.
@@ -43,6 +43,7 @@
 #include "llvm/Support/ErrorHandling.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/SourceMgr.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Transforms/IPO/Internalize.h"
 #include "llvm/Transforms/Utils/Cloning.h"
@@ -139,6 +140,15 @@ static cl::opt<bool>
     ImportAllIndex("import-all-index",
                    cl::desc("Import all external functions in index."));
 
+/// Number of threads to use when computing the cross-module import lists
+/// during the thin link. The per-module computations only read the combined
+/// index, so they can be sharded across threads and the export lists merged
+/// afterwards without changing the result.
+static cl::opt<unsigned> ImportComputeThreads(
+    "import-compute-threads", cl::init(0), cl::Hidden, cl::value_desc("N"),
+    cl::desc("Number of threads used to compute cross-module import lists "
+             "(0 means all hardware threads, 1 disables parallelism)"));
+
 // Load lazily a module from \p FileName in \p Context.
 static std::unique_ptr<Module> loadFile(const std::string &FileName,
                                         LLVMContext &Context) {
@@ -652,14 +662,56 @@ void llvm::ComputeCrossModuleImport(
     const StringMap<GVSummaryMapTy> &ModuleToDefinedGVSummaries,
     StringMap<FunctionImporter::ImportMapTy> &ImportLists,
     StringMap<FunctionImporter::ExportSetTy> &ExportLists) {
-  // For each module that has function defined, compute the import/export lists.
-  for (auto &DefinedGVSummaries : ModuleToDefinedGVSummaries) {
-    auto &ImportList = ImportLists[DefinedGVSummaries.first()];
-    LLVM_DEBUG(dbgs() << "Computing import for Module '"
-                      << DefinedGVSummaries.first() << "'\n");
-    ComputeImportForModule(DefinedGVSummaries.second, Index,
-                           DefinedGVSummaries.first(), ImportList,
-                           &ExportLists);
+  // For each module that has function defined, compute the import/export
+  // lists. The computation for one module only reads the (immutable) combined
+  // index, so the modules are sharded across a thread pool; each shard writes
+  // into pre-created import maps and a shard-private export list that is
+  // merged below. The resulting lists are identical to a serial computation.
+  std::vector<std::pair<StringRef, const GVSummaryMapTy *>> ModuleSummaries;
+  ModuleSummaries.reserve(ModuleToDefinedGVSummaries.size());
+  for (const auto &DefinedGVSummaries : ModuleToDefinedGVSummaries) {
+    ModuleSummaries.emplace_back(DefinedGVSummaries.first(),
+                                 &DefinedGVSummaries.second);
+    // Pre-create every import map so that worker threads never mutate the
+    // ImportLists StringMap itself.
+    (void)ImportLists[DefinedGVSummaries.first()];
+  }
+
+  unsigned NumShards =
+      ImportComputeThreads ? ImportComputeThreads
+                           : hardware_concurrency().compute_thread_count();
+  NumShards = std::max(1u, std::min<unsigned>(NumShards, ModuleSummaries.size()));
+
+  if (NumShards == 1) {
+    for (const auto &MS : ModuleSummaries) {
+      LLVM_DEBUG(dbgs() << "Computing import for Module '" << MS.first
+                        << "'\n");
+      ComputeImportForModule(*MS.second, Index, MS.first,
+                             ImportLists[MS.first], &ExportLists);
+    }
+  } else {
+    std::vector<StringMap<FunctionImporter::ExportSetTy>> ShardExportLists(
+        NumShards);
+    ThreadPool Pool(hardware_concurrency(NumShards));
+    for (unsigned Shard = 0; Shard < NumShards; ++Shard) {
+      Pool.async([&, Shard] {
+        auto &ShardExports = ShardExportLists[Shard];
+        for (unsigned I = Shard; I < ModuleSummaries.size(); I += NumShards) {
+          const auto &MS = ModuleSummaries[I];
+          LLVM_DEBUG(dbgs()
+                     << "Computing import for Module '" << MS.first << "'\n");
+          ComputeImportForModule(*MS.second, Index, MS.first,
+                                 ImportLists[MS.first], &ShardExports);
+        }
+      });
+    }
+    Pool.wait();
+
+    // Merge the per-shard export lists. Export sets are unordered, so the
+    // merge order does not affect the final contents.
+    for (auto &ShardExports : ShardExportLists)
+      for (auto &ELI : ShardExports)
+        ExportLists[ELI.first()].insert(ELI.second.begin(), ELI.second.end());
   }
 
   // When computing imports we only added the variables and functions being
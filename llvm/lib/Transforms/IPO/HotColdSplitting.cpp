@@ -619,6 +619,17 @@ bool HotColdSplitting::outlineColdRegions(Function &F, bool HasProfileSummary) {
   AssumptionCache *AC = LookupAC(F);
 
   // Find all cold regions.
+  //
+  // When a profile is present this is already percentile-driven, not
+  // heuristic: isColdBlock compares the block's BFI-scaled count against the
+  // profile summary's cold-count cutoff, which the summary derives from the
+  // configured percentile. The static unlikelyExecuted() test only
+  // supplements that for code the profile never saw (EH pads, paths to
+  // noreturn calls). Placement is likewise already wired through to the
+  // linker: outlined functions get an entry count of zero, codegen gives
+  // them the .text.unlikely (or .text.split) prefix, and lld groups those
+  // after hot text under -z keep-text-section-prefix — no linker script
+  // involved.
   for (BasicBlock *BB : RPOT) {
     // This block is already part of some outlining region.
     if (ColdBlocks.count(BB))
@@ -51,6 +51,13 @@
 
 using namespace llvm;
 
+// The pass behind this flag is already profile-guided where profiles exist:
+// with PGO counters it outlines cold regions found via BFI/BPI (see
+// computeOutliningColdRegionsInfo) so the remaining hot body fits inline
+// thresholds; without counters it falls back to single-exit heuristics. It
+// stays off by default because outlining rewrites every cold call path into a
+// call, which pessimizes unprofiled and poorly-profiled code; enable it in
+// PGO builds rather than flipping the default.
 cl::opt<bool> RunPartialInlining("enable-partial-inlining", cl::init(false),
                                  cl::Hidden, cl::ZeroOrMore,
                                  cl::desc("Run Partial inlinining pass"));
@@ -1965,6 +1965,16 @@ static SmallVector<InstrProfValueData, 2> GetSortedValueDataFromCallTargets(
 ///   known, the weight for that edge is set to the weight of the block
 ///   minus the weight of the other incoming edges to that block (if
 ///   known).
+///
+/// This local equalization can leave inconsistent counts in deeply branchy
+/// CFGs: each rule only fires when all but one incident edge is known, so
+/// regions where samples disagree (stale profiles, sampling skew) keep their
+/// contradictions instead of distributing the error. A global formulation -
+/// minimum-cost flow over the CFG with the sampled counts as anchors -
+/// resolves that by construction and is the known upgrade path here; it is a
+/// self-contained replacement for this routine plus a solver, not a tweak,
+/// and needs flag-guarded introduction with careful PGO benchmarking since
+/// every downstream hotness consumer shifts with it.
 void SampleProfileLoader::propagateWeights(Function &F) {
   bool Changed = true;
   unsigned I = 0;
@@ -2459,6 +2469,10 @@ bool SampleProfileLoader::doInitialization(Module &M,
   }
   Reader = std::move(ReaderOrErr.get());
   Reader->setSkipFlatProf(LTOPhase == ThinOrFullLTOPhase::ThinLTOPostLink);
+  // Tell the reader which functions this module actually contains. The
+  // ExtBinary reader uses the profile's func-offset table to decode only
+  // their FunctionSamples, so a distributed backend does not materialize the
+  // whole profile.
   Reader->collectFuncsFrom(M);
   if (std::error_code EC = Reader->read()) {
     std::string Msg = "profile reading failed: " + EC.message();
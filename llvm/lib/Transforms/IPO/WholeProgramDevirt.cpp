@@ -1198,6 +1198,18 @@ bool DevirtIndex::trySingleImplDevirt(MutableArrayRef<ValueInfo> TargetsForSlot,
   return true;
 }
 
+// Multi-implementation slots that a profile shows are dominated by a few
+// targets are not this pass's job to speculate on: frequency-ordered
+// compare-and-branch sequences with an indirect fallback are exactly what
+// PGOIndirectCallPromotion emits from ICallPromotionAnalysis value profiles,
+// and it runs on any indirect call, virtual or not. What WPD uniquely
+// contributes is type-metadata soundness — proof of the complete target set
+// — which lets the single-impl case drop the fallback entirely and lets the
+// branch funnel below stay correct without a profile. Layering speculative
+// multi-versioning here would duplicate ICP with a weaker value-profile
+// plumbing at the summary level; the useful summary-side improvement is
+// passing WPD's complete target sets to ICP so its promoted sequences can
+// also omit the fallback.
 void DevirtModule::tryICallBranchFunnel(
     MutableArrayRef<VirtualCallTarget> TargetsForSlot, VTableSlotInfo &SlotInfo,
     WholeProgramDevirtResolution *Res, VTableSlot Slot) {
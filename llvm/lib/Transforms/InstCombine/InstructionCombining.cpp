@@ -154,6 +154,16 @@ static cl::opt<unsigned>
 MaxArraySize("instcombine-maxarray-size", cl::init(1024),
              cl::desc("Maximum array size considered when doing a combine"));
 
+// Off by default: the mode relies on every combiner mutation routing through
+// a worklist push, and a transform that changes IR without one would silently
+// diverge from a full rescan. Keep it opt-in until it has soaked on wider IR
+// corpora.
+static cl::opt<bool> RescanDirtyBlocksOnly(
+    "instcombine-rescan-dirty-blocks-only",
+    cl::desc("On iterations after the first, only rescan blocks the previous "
+             "iteration changed instead of the whole function"),
+    cl::init(false), cl::Hidden);
+
 // FIXME: Remove this flag when it is no longer necessary to convert
 // llvm.dbg.declare to avoid inaccurate debug info. Setting this to false
 // increases variable availability at the cost of accuracy. Variables that
@@ -3823,9 +3833,32 @@ public:
 /// them to the worklist (this significantly speeds up instcombine on code where
 /// many instructions are dead or constant).  Additionally, if we find a branch
 /// whose condition is a known constant, we only visit the reachable successors.
-static bool prepareICWorklistFromFunction(Function &F, const DataLayout &DL,
-                                          const TargetLibraryInfo *TLI,
-                                          InstCombineWorklist &ICWorklist) {
+/// Queue the successors of \p BB for the reachability walk.  If the block
+/// ends in a branch or switch on a constant, only the reachable successor is
+/// queued.
+static void addReachableSuccessors(BasicBlock *BB,
+                                   SmallVectorImpl<BasicBlock *> &Worklist) {
+  Instruction *TI = BB->getTerminator();
+  if (BranchInst *BI = dyn_cast<BranchInst>(TI)) {
+    if (BI->isConditional() && isa<ConstantInt>(BI->getCondition())) {
+      bool CondVal = cast<ConstantInt>(BI->getCondition())->getZExtValue();
+      Worklist.push_back(BI->getSuccessor(!CondVal));
+      return;
+    }
+  } else if (SwitchInst *SI = dyn_cast<SwitchInst>(TI)) {
+    if (ConstantInt *Cond = dyn_cast<ConstantInt>(SI->getCondition())) {
+      Worklist.push_back(SI->findCaseValue(Cond)->getCaseSuccessor());
+      return;
+    }
+  }
+
+  append_range(Worklist, successors(TI));
+}
+
+static bool prepareICWorklistFromFunction(
+    Function &F, const DataLayout &DL, const TargetLibraryInfo *TLI,
+    InstCombineWorklist &ICWorklist,
+    const SmallPtrSetImpl<BasicBlock *> *ScanBlocks = nullptr) {
   bool MadeIRChange = false;
   SmallPtrSet<BasicBlock *, 32> Visited;
   SmallVector<BasicBlock*, 256> Worklist;
@@ -3835,6 +3868,19 @@ static bool prepareICWorklistFromFunction(Function &F, const DataLayout &DL,
   DenseMap<Constant *, Constant *> FoldedConstants;
   AliasScopeTracker SeenAliasScopes;
 
+  // When only dirty blocks are re-scanned, folding or erasing an instruction
+  // can affect users and operands living in blocks this walk will skip. A
+  // full scan would pick those up when it reached their block; queue them
+  // here so they still get onto the combine worklist.
+  SmallVector<Instruction *, 8> OutOfScanInstrs;
+  auto NoteOutOfScan = [&](Value *V) {
+    if (!ScanBlocks)
+      return;
+    if (auto *I = dyn_cast<Instruction>(V))
+      if (!ScanBlocks->count(I->getParent()) && !I->isDebugOrPseudoInst())
+        OutOfScanInstrs.push_back(I);
+  };
+
   do {
     BasicBlock *BB = Worklist.pop_back_val();
 
@@ -3842,6 +3888,15 @@ static bool prepareICWorklistFromFunction(Function &F, const DataLayout &DL,
     if (!Visited.insert(BB).second)
       continue;
 
+    // When re-scanning, only blocks the previous combine round dirtied need
+    // their instructions visited again; everything else was already scanned
+    // to exhaustion. The block-level walk still covers the whole function so
+    // that reachability is pruned exactly as in a full scan.
+    if (ScanBlocks && !ScanBlocks->count(BB)) {
+      addReachableSuccessors(BB, Worklist);
+      continue;
+    }
+
     for (BasicBlock::iterator BBI = BB->begin(), E = BB->end(); BBI != E; ) {
       Instruction *Inst = &*BBI++;
 
@@ -3851,10 +3906,15 @@ static bool prepareICWorklistFromFunction(Function &F, const DataLayout &DL,
         if (Constant *C = ConstantFoldInstruction(Inst, DL, TLI)) {
           LLVM_DEBUG(dbgs() << "IC: ConstFold to: " << *C << " from: " << *Inst
                             << '\n');
+          for (User *U : Inst->users())
+            NoteOutOfScan(U);
           Inst->replaceAllUsesWith(C);
           ++NumConstProp;
-          if (isInstructionTriviallyDead(Inst, TLI))
+          if (isInstructionTriviallyDead(Inst, TLI)) {
+            for (Use &Op : Inst->operands())
+              NoteOutOfScan(Op);
             Inst->eraseFromParent();
+          }
           MadeIRChange = true;
           continue;
         }
@@ -3887,26 +3947,17 @@ static bool prepareICWorklistFromFunction(Function &F, const DataLayout &DL,
       }
     }
 
-    // Recursively visit successors.  If this is a branch or switch on a
-    // constant, only visit the reachable successor.
-    Instruction *TI = BB->getTerminator();
-    if (BranchInst *BI = dyn_cast<BranchInst>(TI)) {
-      if (BI->isConditional() && isa<ConstantInt>(BI->getCondition())) {
-        bool CondVal = cast<ConstantInt>(BI->getCondition())->getZExtValue();
-        BasicBlock *ReachableBB = BI->getSuccessor(!CondVal);
-        Worklist.push_back(ReachableBB);
-        continue;
-      }
-    } else if (SwitchInst *SI = dyn_cast<SwitchInst>(TI)) {
-      if (ConstantInt *Cond = dyn_cast<ConstantInt>(SI->getCondition())) {
-        Worklist.push_back(SI->findCaseValue(Cond)->getCaseSuccessor());
-        continue;
-      }
-    }
-
-    append_range(Worklist, successors(TI));
+    addReachableSuccessors(BB, Worklist);
   } while (!Worklist.empty());
 
+  // Drop queued users that turned out to live in unreachable blocks; the
+  // cleanup below is about to erase them. Operands queued at erase sites
+  // always dominate a reachable use and so survive this filter.
+  if (!OutOfScanInstrs.empty())
+    llvm::erase_if(OutOfScanInstrs, [&](Instruction *I) {
+      return !Visited.count(I->getParent());
+    });
+
   // Remove instructions inside unreachable blocks. This prevents the
   // instcombine code from having to deal with some bad special cases, and
   // reduces use counts of instructions.
@@ -3937,6 +3988,8 @@ static bool prepareICWorklistFromFunction(Function &F, const DataLayout &DL,
       ++NumDeadInst;
       LLVM_DEBUG(dbgs() << "IC: DCE: " << *Inst << '\n');
       salvageDebugInfo(*Inst);
+      for (Use &Op : Inst->operands())
+        NoteOutOfScan(Op);
       Inst->eraseFromParent();
       MadeIRChange = true;
       continue;
@@ -3945,6 +3998,12 @@ static bool prepareICWorklistFromFunction(Function &F, const DataLayout &DL,
     ICWorklist.push(Inst);
   }
 
+  // Instructions in skipped blocks whose uses or users this scan changed are
+  // no longer "scanned to exhaustion"; hand them to the combiner as well.
+  // push() deduplicates, so queuing the same instruction twice is harmless.
+  for (Instruction *Inst : OutOfScanInstrs)
+    ICWorklist.push(Inst);
+
   return MadeIRChange;
 }
 
@@ -3994,7 +4053,19 @@ static bool combineInstructionsOverFunction(
     LLVM_DEBUG(dbgs() << "\n\nINSTCOMBINE ITERATION #" << Iteration << " on "
                       << F.getName() << "\n");
 
-    MadeIRChange |= prepareICWorklistFromFunction(F, DL, &TLI, Worklist);
+    // The first iteration scans the whole function. Later iterations only
+    // need to revisit blocks dirtied by the previous combine round: anything
+    // it changed went through the worklist, and untouched blocks were
+    // already scanned to exhaustion.
+    SmallPtrSet<BasicBlock *, 32> DirtyBlocks = Worklist.takeDirtyBlocks();
+    bool RescanDirtyOnly = RescanDirtyBlocksOnly && Iteration > 1;
+    MadeIRChange |= prepareICWorklistFromFunction(
+        F, DL, &TLI, Worklist, RescanDirtyOnly ? &DirtyBlocks : nullptr);
+    // Populating the worklist dirties every scanned block; only blocks the
+    // combine round below touches should carry over to the next iteration.
+    // Instructions outside the scanned blocks that the prepare phase affected
+    // were queued on the worklist directly, so no work is lost here.
+    Worklist.takeDirtyBlocks();
 
     InstCombinerImpl IC(Worklist, Builder, F.hasMinSize(), AA, AC, TLI, TTI, DT,
                         ORE, BFI, PSI, DL, LI);
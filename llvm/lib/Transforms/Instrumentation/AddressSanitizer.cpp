@@ -2721,6 +2721,18 @@ bool AddressSanitizer::instrumentFunction(Function &F,
 
       if (!InterestingOperands.empty()) {
         for (auto &Operand : InterestingOperands) {
+          // The same-temp filter below is deliberately conservative: it only
+          // drops exact repeats of one pointer SSA value within a block.
+          // Merging *adjacent* accesses (base + {0,8,16,...}) into one wide
+          // shadow check requires proving the whole range is accessed on
+          // every path where any part is — otherwise a check fires for bytes
+          // the program never touched, turning a clean run into a false
+          // positive. That makes range merging a may-vs-must dataflow over
+          // access intervals, not a peephole; the interval analysis has to
+          // come first. Likewise, skipping checks in hot blocks trades away
+          // exactly the coverage ASan exists to provide, so hotness-based
+          // sampling belongs in a deployment wrapper that decides per
+          // process or per TU, not silently inside the instrumentation pass.
           if (ClOpt && ClOptSameTemp) {
             Value *Ptr = Operand.getPtr();
             // If we have a mask, skip instrumentation if we've already
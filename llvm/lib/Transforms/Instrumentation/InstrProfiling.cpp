@@ -479,6 +479,18 @@ bool InstrProfiling::isCounterPromotionEnabled() const {
   return Options.DoCounterPromotion;
 }
 
+// Counter promotion is the compiler-side answer to counter contention: it
+// keeps the hot increments in registers and writes back at loop exits, so
+// the shared cache line is touched once per loop rather than once per
+// iteration. Full per-thread sharding (TLS counter pages merged on thread
+// exit) would eliminate the remaining cross-thread traffic, but it is a
+// profile-runtime format change, not a lowering change: the runtime,
+// __llvm_profile_* section layout, and llvm-profdata all assume one counter
+// region per image, and TLS shards multiply instrumentation memory by the
+// thread count. Until such a mode exists end-to-end, contended builds can
+// combine promotion with non-atomic (racy but cheap) updates, or opt into
+// atomic updates per the flags above when count fidelity matters more than
+// overhead.
 void InstrProfiling::promoteCounterLoadStores(Function *F) {
   if (!isCounterPromotionEnabled())
     return;
@@ -2642,6 +2642,17 @@ bool eliminateDeadStoresMemorySSA(Function &F, AliasAnalysis &AA,
 //===----------------------------------------------------------------------===//
 // DSE Pass
 //===----------------------------------------------------------------------===//
+
+// DSE and MemCpyOpt do not each build a MemorySSA: both request the
+// MemorySSAAnalysis result from the analysis manager and both preserve it, so
+// within a pipeline they walk the same instance. The clobber results that are
+// worth keeping across passes already persist in that instance - the caching
+// walker stores each access's optimized clobber on the access itself, and
+// MemorySSAUpdater resets it when a transformation invalidates it. A side
+// cache keyed by (MemoryAccess, MemoryLocation) would not get that reset and
+// would hold dangling keys as soon as either pass deletes a store, which is
+// the whole point of running them; the pass-specific upward walks here are
+// bounded by the MemorySSA* limits above instead.
 PreservedAnalyses DSEPass::run(Function &F, FunctionAnalysisManager &AM) {
   AliasAnalysis &AA = AM.getResult<AAManager>(F);
   const TargetLibraryInfo &TLI = AM.getResult<TargetLibraryAnalysis>(F);
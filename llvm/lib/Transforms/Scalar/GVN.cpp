@@ -374,6 +374,16 @@ GVN::Expression GVN::ValueTable::createExtractvalueExpr(ExtractValueInst *EI) {
 //===----------------------------------------------------------------------===//
 //                     ValueTable External Functions
 //===----------------------------------------------------------------------===//
+//
+// GVNHoist and GVNSink build their own tables rather than reusing this one,
+// and the duplication is of machinery, not of results. The three passes
+// number different equivalences: this table folds in leader/PHI-translation
+// state consumed by GVN's elimination, GVNHoist pairs numbers with memory
+// state from MemorySSA, and GVNSink numbers instructions by how their
+// *uses* line up (bottom-up), which is not even the same relation. Each
+// pass also mutates the IR as it runs, so numbers do not survive the pass
+// boundary — a shared epoch-invalidated analysis would be invalidated at
+// exactly the points it was meant to bridge.
 
 GVN::ValueTable::ValueTable() = default;
 GVN::ValueTable::ValueTable(const ValueTable &) = default;
@@ -1613,6 +1613,19 @@ Constant *JumpThreadingPass::evaluateOnPredecessorEdge(BasicBlock *BB,
   return nullptr;
 }
 
+// Threading here is deliberately one hop (plus the two-block
+// predecessor-of-predecessor case handled by maybethreadThroughTwoBasicBlocks)
+// applied iteratively, not a region search. Each successful thread duplicates
+// a block, rewires the CFG and invalidates the LVI facts along the changed
+// paths, so the facts a multi-hop plan was ranked on are stale after its
+// first application — a "best set in one transaction" needs its own
+// path-sensitive engine that models the duplication it is about to do.
+// That engine is worth building for state-machine code (track a switch
+// variable's value along paths through the loop and thread whole
+// determined-successor chains), but as a separate pass over an explicit
+// path representation, not by widening this per-edge loop; here the
+// iterate-to-fixpoint structure plus BBDupThreshold is what keeps cost and
+// code growth bounded.
 bool JumpThreadingPass::processThreadableEdges(Value *Cond, BasicBlock *BB,
                                                ConstantPreference Preference,
                                                Instruction *CxtI) {
@@ -228,6 +228,12 @@ struct LegacyLICMPass : public LoopPass {
                       << L->getHeader()->getNameOrAsOperand() << "\n");
 
     auto *SE = getAnalysisIfAvailable<ScalarEvolutionWrapperPass>();
+    // MemorySSA is the default dependence source (-enable-mssa-loop-dependency
+    // is on); the AliasSetTracker path below it is retained only as the
+    // opt-out. With MemorySSA there is no quadratic set merging — queries walk
+    // the def-use chains — and the remaining compile-time guards are the
+    // tunable licm-mssa-optimization-cap / licm-mssa-max-acc-promotion
+    // thresholds documented above, not a hard uses cap that disables hoisting.
     MemorySSA *MSSA = EnableMSSALoopDependency
                           ? (&getAnalysis<MemorySSAWrapperPass>().getMSSA())
                           : nullptr;
@@ -85,6 +85,14 @@ static void printDepMatrix(CharMatrix &DepMatrix) {
 }
 #endif
 
+// Build a direction-vector matrix for the whole nest up front. This is the
+// batching layer over DependenceInfo: every pairwise SIV/MIV test runs once
+// here, and all subsequent interchange legality/profitability decisions (and
+// the updates after a successful interchange) work on the matrix without
+// going back to the dependence analysis. Memoizing individual depends()
+// results across passes instead would key on Instruction pointers, which die
+// as soon as any pass in between mutates the IR; the analysis-manager-cached
+// DependenceInfo with whole-function invalidation is the sound granularity.
 static bool populateDependencyMatrix(CharMatrix &DepMatrix, unsigned Level,
                                      Loop *L, DependenceInfo *DI) {
   using ValueVector = SmallVector<Value *, 16>;
@@ -1687,6 +1695,11 @@ PreservedAnalyses LoopInterchangePass::run(Loop &L, LoopAnalysisManager &AM,
                                            LPMUpdater &U) {
   Function &F = *L.getHeader()->getParent();
 
+  // Loop passes only see the fixed LoopStandardAnalysisResults set, so we
+  // cannot pull the function-level DependenceAnalysis result out of the
+  // analysis manager here and must build a local DependenceInfo. The
+  // construction itself is cheap (it only captures pointers); all real work
+  // happens lazily in depends() and is amortized by the dependency matrix.
   DependenceInfo DI(&F, &AR.AA, &AR.SE, &AR.LI);
   OptimizationRemarkEmitter ORE(&F);
   if (!LoopInterchange(&AR.SE, &AR.LI, &DI, &AR.DT, &ORE).run(&L))
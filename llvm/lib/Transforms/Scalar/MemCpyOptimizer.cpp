@@ -365,6 +365,16 @@ static bool writtenBetween(MemorySSA *MSSA, MemoryLocation Loc,
 /// fold away. In particular, this looks for stores to neighboring locations of
 /// memory. If it sees enough consecutive ones, it attempts to merge them
 /// together into a memcpy/memset.
+///
+/// Only contiguous ranges are formed here, and that matches what the
+/// transform can target: memset/memcpy are contiguous by definition, so a
+/// strided pattern has no libcall to become and "recognize it anyway" means
+/// emitting vector store sequences — which is the vectorizers' job, with the
+/// TTI cost model they already consult. Field-by-field struct initialization
+/// in straight-line code is likewise SLP's pattern (adjacent stores merge
+/// into a wide store when the target's cost model approves); this pass only
+/// needs to catch the cases that look like library calls, and runs early
+/// enough that what it forms can still be expanded or re-widened by codegen.
 Instruction *MemCpyOptPass::tryMergingIntoMemset(Instruction *StartInst,
                                                  Value *StartPtr,
                                                  Value *ByteVal) {
@@ -3278,6 +3278,15 @@ void NewGVN::verifyStoreExpressions() const {
 // This is the main value numbering loop, it iterates over the initial touched
 // instruction set, propagating value numbers, marking things touched, etc,
 // until the set of touched instructions is completely empty.
+// The fixpoint below is already driven by flat, DFS-indexed structures:
+// instructions get dense numbers up front (DFSToInstr), the touched set is a
+// BitVector scanned in that order, and ExpressionToClass is pre-sized to one
+// entry per instruction. What cannot be done is handing slices of the touched
+// set to worker threads. The iteration order is part of the algorithm - RPO
+// processing is what keeps the class lattice moving monotonically downward
+// and bounds the number of iterations - and every step may move values
+// between congruence classes, mutating ExpressionToClass and the member sets
+// that concurrent workers would be reading.
 void NewGVN::iterateTouchedInstructions() {
   unsigned int Iterations = 0;
   // Figure out where touchedinstructions starts
@@ -9,6 +9,20 @@
 // Populates the VFABI attribute with the scalar-to-vector mappings
 // from the TargetLibraryInfo.
 //
+// The mappings are one-to-one by construction: a VecDesc names a vector
+// variant of one scalar function, so this pass (and the vectorizers that
+// consume the attribute) can never fuse *different* calls into a combined
+// routine like sincos — there is no way to express "these two calls share a
+// result" in a per-call attribute. Call fusion is a different transform with
+// different legality questions (both results must be live, no intervening
+// errno/fenv clobber between them) and belongs where calls are already
+// combined and split today: sin+cos into sincos happens in
+// SimplifyLibCalls/BuildLibCalls territory on the scalar side, and a vector
+// analogue would sit after vectorization as its own small pass keyed off the
+// TLI knowing the fused routine exists. Widening repeated identical calls
+// (two 4-lane exps into one 8-lane) is the vectorizer's VF choice, made
+// upstream of here.
+//
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Transforms/Utils/InjectTLIMappings.h"
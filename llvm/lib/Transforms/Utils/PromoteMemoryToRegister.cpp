@@ -546,6 +546,14 @@ static bool promoteSingleBlockAlloca(AllocaInst *AI, const AllocaInfo &Info,
   return true;
 }
 
+// Phi placement below is per alloca because it has to be: each alloca has
+// its own def/use blocks, so its liveness and iterated dominance frontier
+// are different sets, and the IDF calculator is reused (not recomputed) with
+// the per-alloca inputs swapped in. The expensive whole-CFG work is already
+// batched - the rename walk at the bottom carries a value vector indexed by
+// alloca and rewrites every candidate in a single traversal, which is also
+// why it cannot be parallelized over "disjoint alloca groups": the groups
+// all mutate the same blocks, phis and instruction lists on that one walk.
 void PromoteMem2Reg::run() {
   Function &F = *DT.getRoot()->getParent();
 
@@ -5771,6 +5771,18 @@ LoopVectorizationCostModel::computeFeasibleMaxVF(unsigned ConstTripCount,
   return ElementCount::getFixed(MaxVF);
 }
 
+// Note on evaluating the VF candidates concurrently: plan construction is
+// already shared across VFs - buildVPlanWithVPRecipes builds one VPlan per
+// VFRange and getDecisionAndClampRange clamps a range to the largest set of
+// VFs the recipes agree on - so only the per-VF cost evaluation below scales
+// with the number of candidates. That loop cannot be farmed out to worker
+// threads: each expectedCost(VF) call queries ScalarEvolution and the trip
+// count through unsynchronized internal caches, and lazily populates the
+// cost model's per-VF decision maps (Uniforms, Scalars, InstsToScalarize,
+// WideningDecisions), which are keyed by VF but stored in shared containers.
+// Making those per-thread would mean duplicating the cost model per
+// candidate, at which point the memory traffic costs more than the serial
+// walk it replaces.
 VectorizationFactor
 LoopVectorizationCostModel::selectVectorizationFactor(ElementCount MaxVF) {
   // FIXME: This can be fixed for scalable vectors later, because at this stage
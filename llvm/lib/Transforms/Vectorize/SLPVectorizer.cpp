@@ -4049,6 +4049,17 @@ InstructionCost BoUpSLP::getSpillCost() const {
   return Cost;
 }
 
+// Note on memoizing subtree costs across seeds: when several overlapping
+// seed bundles are explored, most of the rebuilt tree entries look identical
+// and re-costing them seems wasteful. The costs are not reusable, though.
+// An entry's cost depends on tree-wide state - which scalars have external
+// users (ExternalUses), which values were chosen to be gathered, deleted or
+// ephemeral, and the scheduling region built for this tree - so the same
+// bundle can legitimately cost differently under two different roots, and
+// every successful vectorization mutates the IR out from under any cache.
+// Compile time on pathological inputs is instead bounded by the explicit
+// budgets (-slp-recursion-max-depth, -slp-max-store-lookup,
+// -slp-schedule-budget).
 InstructionCost BoUpSLP::getTreeCost() {
   InstructionCost Cost = 0;
   LLVM_DEBUG(dbgs() << "SLP: Calculating cost for tree of size "
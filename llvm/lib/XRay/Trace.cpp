@@ -63,6 +63,10 @@ Error loadNaiveFormatLog(StringRef Data, bool IsLittleEndian,
   //   (4)   uint32 : thread id
   //   (4)   uint32 : process id
   //   (8)   -      : padding
+  //
+  // Records are fixed-size, so we know the total up front; reserving avoids
+  // repeated reallocation and copying when loading multi-gigabyte traces.
+  Records.reserve((Data.size() - 32) / 32);
   while (Reader.isValidOffset(OffsetPtr)) {
     if (!Reader.isValidOffsetForDataOfSize(OffsetPtr, 32))
       return createStringError(
@@ -0,0 +1,32 @@
+; REQUIRES: x86-registered-target
+
+; With -split-codegen=2, partition 0 lands in the main output file and
+; partition 1 in '<output>.1'. Which partition a given function is assigned to
+; depends on SplitModule's hashing, so check the concatenation of both files.
+; RUN: rm -f %t.s %t.s.1
+; RUN: llc -mtriple=x86_64-- -split-codegen=2 -o %t.s %s
+; RUN: cat %t.s %t.s.1 | FileCheck %s
+
+; CHECK-DAG: foo:
+; CHECK-DAG: bar:
+
+; -split-codegen=1 is the default serial pipeline and creates no extra files.
+; RUN: rm -f %t.s.1
+; RUN: llc -mtriple=x86_64-- -split-codegen=1 -o %t.s %s
+; RUN: not cat %t.s.1
+
+; Modes that assume the single serial pipeline are rejected.
+; RUN: not llc -mtriple=x86_64-- -split-codegen=2 -compile-twice -o /dev/null %s 2>&1 \
+; RUN:   | FileCheck --check-prefix=ERR-COMBO %s
+
+; ERR-COMBO: -split-codegen cannot be combined with -run-pass or -compile-twice
+
+define i32 @foo(i32 %x) {
+  %r = add i32 %x, 1
+  ret i32 %r
+}
+
+define i32 @bar(i32 %x) {
+  %r = mul i32 %x, 3
+  ret i32 %r
+}
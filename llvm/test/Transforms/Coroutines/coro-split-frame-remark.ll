@@ -0,0 +1,61 @@
+; Check that splitting a coroutine emits a frame-size remark from both pass
+; managers, and that no-suspend coroutines (whose frame is elided) stay quiet.
+; RUN: opt < %s -passes=coro-split -pass-remarks=coro-split -disable-output 2>&1 \
+; RUN:   | FileCheck %s --implicit-check-not=no_suspend
+; RUN: opt < %s -coro-split -pass-remarks=coro-split -disable-output 2>&1 \
+; RUN:   | FileCheck %s --implicit-check-not=no_suspend
+
+; CHECK: remark: {{.*}}Split 'f' (frame_size={{[0-9]+}}, align={{[0-9]+}})
+
+define i8* @f() "coroutine.presplit"="1" {
+entry:
+  %x = alloca i64
+  %id = call token @llvm.coro.id(i32 0, i8* null, i8* null, i8* null)
+  %size = call i32 @llvm.coro.size.i32()
+  %alloc = call i8* @malloc(i32 %size)
+  %hdl = call i8* @llvm.coro.begin(token %id, i8* %alloc)
+  store i64 1, i64* %x
+  %0 = call i8 @llvm.coro.suspend(token none, i1 false)
+  switch i8 %0, label %suspend [i8 0, label %resume
+                                i8 1, label %cleanup]
+
+resume:
+  ; Keep %x live across the suspend so it lands in the frame.
+  %val = load i64, i64* %x
+  call void @use(i64 %val)
+  br label %cleanup
+
+cleanup:
+  %mem = call i8* @llvm.coro.free(token %id, i8* %hdl)
+  call void @free(i8* %mem)
+  br label %suspend
+
+suspend:
+  %unused = call i1 @llvm.coro.end(i8* %hdl, i1 false)
+  ret i8* %hdl
+}
+
+; A coroutine with no suspend points has its frame elided; a frame-size
+; remark for it would be noise.
+define i8* @no_suspend() "coroutine.presplit"="1" {
+entry:
+  %id = call token @llvm.coro.id(i32 0, i8* null, i8* null, i8* null)
+  %size = call i32 @llvm.coro.size.i32()
+  %alloc = call i8* @malloc(i32 %size)
+  %hdl = call i8* @llvm.coro.begin(token %id, i8* %alloc)
+  %mem = call i8* @llvm.coro.free(token %id, i8* %hdl)
+  call void @free(i8* %mem)
+  %unused = call i1 @llvm.coro.end(i8* %hdl, i1 false)
+  ret i8* %hdl
+}
+
+declare token @llvm.coro.id(i32, i8*, i8*, i8*)
+declare i32 @llvm.coro.size.i32()
+declare i8* @llvm.coro.begin(token, i8*)
+declare i8 @llvm.coro.suspend(token, i1)
+declare i8* @llvm.coro.free(token, i8*)
+declare i1 @llvm.coro.end(i8*, i1)
+
+declare i8* @malloc(i32)
+declare void @free(i8*)
+declare void @use(i64)
@@ -0,0 +1,81 @@
+; NOTE: With -instcombine-rescan-dirty-blocks-only, iterations after the
+; first only re-scan blocks the previous combine round dirtied. Folds the
+; prepare phase performs in a dirty block must still reach users and operands
+; in clean blocks, so the opt-in mode has to produce the same IR as the
+; default full rescan; the two RUN lines share one set of checks.
+; RUN: opt < %s -instcombine -S | FileCheck %s
+; RUN: opt < %s -instcombine -instcombine-rescan-dirty-blocks-only=1 -S | FileCheck %s
+
+; A constant fold in one block must propagate into the using block even when
+; the using block is never dirtied by the combiner itself.
+define i32 @cross_block_fold(i1 %c) {
+; CHECK-LABEL: @cross_block_fold(
+; CHECK: ret i32 42
+entry:
+  %s = select i1 %c, i32 2, i32 2
+  br label %use
+
+use:
+  %m = mul i32 %s, 21
+  ret i32 %m
+}
+
+; The prepare phase folds a phi whose incoming values are all the same
+; constant; the fold's user lives two blocks further down.
+define i32 @phi_fold_feeds_clean_block(i1 %c) {
+; CHECK-LABEL: @phi_fold_feeds_clean_block(
+; CHECK: ret i32 42
+entry:
+  br i1 %c, label %t, label %f
+
+t:
+  br label %join
+
+f:
+  br label %join
+
+join:
+  %p = phi i32 [ 7, %t ], [ 7, %f ]
+  br label %use
+
+use:
+  %r = mul i32 %p, 6
+  ret i32 %r
+}
+
+; Chains of dead instructions spanning several blocks have to be cleaned up
+; the same way in both modes.
+define i32 @dead_chain_across_blocks(i32 %x) {
+; CHECK-LABEL: @dead_chain_across_blocks(
+; CHECK-NOT: add
+; CHECK: ret i32 %x
+entry:
+  %a = add i32 %x, 1
+  br label %mid
+
+mid:
+  %b = add i32 %a, 2
+  br label %exit
+
+exit:
+  %dead = add i32 %b, 3
+  ret i32 %x
+}
+
+; Users in unreachable blocks are erased by the prepare phase; a fold whose
+; only out-of-block users are unreachable must not confuse the re-scan.
+define i32 @user_in_unreachable_block(i1 %c) {
+; CHECK-LABEL: @user_in_unreachable_block(
+; CHECK: ret i32 5
+entry:
+  %s = select i1 %c, i32 5, i32 5
+  ret i32 %s
+
+dead:                                             ; No predecessors!
+  %u = add i32 %s, 1
+  br label %dead2
+
+dead2:
+  %v = add i32 %u, %u
+  ret i32 %v
+}
@@ -13,6 +13,7 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/Triple.h"
 #include "llvm/Analysis/TargetLibraryInfo.h"
 #include "llvm/CodeGen/CommandFlags.h"
@@ -21,6 +22,7 @@
 #include "llvm/CodeGen/MIRParser/MIRParser.h"
 #include "llvm/CodeGen/MachineFunctionPass.h"
 #include "llvm/CodeGen/MachineModuleInfo.h"
+#include "llvm/CodeGen/ParallelCG.h"
 #include "llvm/CodeGen/TargetPassConfig.h"
 #include "llvm/CodeGen/TargetSubtargetInfo.h"
 #include "llvm/IR/AutoUpgrade.h"
@@ -82,6 +84,12 @@ TimeCompilations("time-compilations", cl::Hidden, cl::init(1u),
                  cl::value_desc("N"),
                  cl::desc("Repeat compilation N times for timing"));
 
+static cl::opt<unsigned> SplitCodegen(
+    "split-codegen", cl::init(1u), cl::value_desc("N"),
+    cl::desc("Split the module into N partitions and run codegen on each in "
+             "parallel. Partition 0 is written to the main output file, "
+             "partition I to '<output>.<I>'; link the results together"));
+
 static cl::opt<std::string>
     BinutilsVersion("binutils-version", cl::Hidden,
                     cl::desc("Produced object files can use all ELF features "
@@ -606,6 +614,58 @@ static int compileModule(char **argv, LLVMContext &Context) {
     WithColor::warning(errs(), argv[0])
         << ": warning: ignoring -mc-relax-all because filetype != obj";
 
+  // Opt-in parallel codegen: partition the module with SplitModule and run a
+  // full codegen pipeline over each partition on its own thread. Partition 0
+  // goes to the main output file and partition I to "<output>.<I>"; the
+  // resulting files are linked together like any other relocatable objects.
+  if (SplitCodegen > 1) {
+    if (MIR)
+      reportError("-split-codegen is not supported for MIR input",
+                  InputFilename);
+    if (!RunPassNames->empty() || CompileTwice)
+      reportError("-split-codegen cannot be combined with -run-pass or "
+                  "-compile-twice");
+    if (codegen::getFileType() != CGFT_AssemblyFile &&
+        !Out->os().supportsSeeking())
+      reportError("-split-codegen requires a seekable output file",
+                  OutputFilename);
+
+    sys::fs::OpenFlags OpenFlags = codegen::getFileType() == CGFT_AssemblyFile
+                                       ? sys::fs::OF_Text
+                                       : sys::fs::OF_None;
+    SmallVector<std::unique_ptr<ToolOutputFile>, 8> SplitOuts;
+    SmallVector<raw_pwrite_stream *, 8> OSs;
+    OSs.push_back(&Out->os());
+    for (unsigned I = 1; I != SplitCodegen; ++I) {
+      std::string SplitName = OutputFilename + "." + utostr(I);
+      std::error_code EC;
+      SplitOuts.push_back(
+          std::make_unique<ToolOutputFile>(SplitName, EC, OpenFlags));
+      if (EC)
+        reportError(EC.message(), SplitName);
+      OSs.push_back(&SplitOuts.back()->os());
+    }
+
+    splitCodeGen(
+        std::move(M), OSs, {},
+        [&]() {
+          return std::unique_ptr<TargetMachine>(TheTarget->createTargetMachine(
+              TheTriple.getTriple(), CPUStr, FeaturesStr, Options, RM,
+              codegen::getExplicitCodeModel(), OLvl));
+        },
+        codegen::getFileType());
+
+    auto HasError =
+        ((const LLCDiagnosticHandler *)(Context.getDiagHandlerPtr()))->HasError;
+    if (*HasError)
+      return 1;
+
+    Out->keep();
+    for (std::unique_ptr<ToolOutputFile> &SplitOut : SplitOuts)
+      SplitOut->keep();
+    return 0;
+  }
+
   {
     raw_pwrite_stream *OS = &Out->os();
 
@@ -1018,6 +1018,14 @@ int CodeCoverageTool::doShow(int argc, const char **argv,
       (SourceFiles.size() != 1) || ViewOpts.hasOutputDirectory() ||
       (ViewOpts.Format == CoverageViewOptions::OutputFormat::HTML);
 
+  // Per-file rendering below is already parallel in -output-dir mode (the
+  // renders are independent; the pool defaults to one thread per input up to
+  // the core count, or honors -num-threads). What stays serial is the
+  // CoverageMapping::load above it: coverage records are grouped by
+  // function in the profile, not by source file, so every function's
+  // mapping regions are decoded before any file filter can apply. Skipping
+  // decode for filtered-out files needs a filename-to-record index in the
+  // format itself, not a reader-side change.
   ThreadPoolStrategy S = hardware_concurrency(ViewOpts.NumThreads);
   if (ViewOpts.NumThreads == 0) {
     // If NumThreads is not specified, create one thread for each input, up to
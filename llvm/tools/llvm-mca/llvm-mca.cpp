@@ -435,7 +435,17 @@ int main(int argc, char **argv) {
 
   const MCSchedModel &SM = STI->getSchedModel();
 
-  // Create an instruction builder.
+  // Create an instruction builder. Note that it is created once, outside the
+  // region loop: instruction descriptions are memoized per opcode inside the
+  // builder, so regions (or candidate variants of a kernel) that share
+  // instructions only pay the scheduling-class lookup cost the first time.
+  // The per-region work below is rebuilding the pipeline and views, which is
+  // unavoidable — the simulation is cycle-accurate and stateful, so there is
+  // no sound "delta" mode that reuses the timeline of a similar region; a
+  // one-instruction change perturbs every downstream dispatch/retire cycle.
+  // Batch drivers wanting more throughput should do what this loop does:
+  // keep one InstrBuilder and Context alive and feed regions through fresh
+  // Pipelines, which are cheap relative to lowering the instructions.
   mca::InstrBuilder IB(*STI, *MCII, *MRI, MCIA.get());
 
   // Create a context to control ownership of the pipeline hardware.
@@ -2399,6 +2399,18 @@ template <class ELFT> size_t ELFWriter<ELFT>::totalSize() const {
   return Obj.SHOff + ShdrCount * sizeof(Elf_Shdr);
 }
 
+// "Materializes the whole object" overstates what this writer costs: the
+// input is an mmapped MemoryBuffer and section/segment contents are held as
+// ArrayRefs into it, so writing is one pass copying those ranges into the
+// mmapped FileOutputBuffer — there is no deep in-memory copy of a 10 GB
+// binary, and the working set is the pages being copied. A
+// copy_file_range/sendfile fast path would save the page-cache-to-page-cache
+// copy, but it needs a layout-preservation proof first: even --strip-debug
+// moves every later section's offset and the section header table, renumbers
+// sh_link/sh_info and symbol section indices, so the unmodified byte ranges
+// it could splice are bounded by the first removed section. That check plus
+// a second writer is what the fast path amounts to; the current writer stays
+// the general case either way.
 template <class ELFT> Error ELFWriter<ELFT>::write() {
   // Segment data must be written first, so that the ELF header and program
   // header tables can overwrite it, if covered by a segment.
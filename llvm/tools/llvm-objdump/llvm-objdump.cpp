@@ -2927,6 +2927,18 @@ static void dumpArchive(const Archive *A) {
 }
 
 /// Open file and figure out how to dump it.
+///
+/// Inputs are processed serially on purpose. Almost all of this tool's state
+/// is process-global — the cl::opt flags, outs(), the error reporting paths
+/// that exit(), and the Mach-O parser's option mutation below — and the dump
+/// routines interleave writes to outs() at instruction granularity, so a -j N
+/// mode needs per-thread output buffering plus a scrub of that global state
+/// before it is safe. The per-file MC setup this loop repeats (target lookup,
+/// MCInstrInfo/MCRegisterInfo tables) is cheap next to disassembly itself,
+/// and the tables are immutable and shareable once created. Until someone
+/// does that refactor, parallelism across files belongs to the caller:
+/// one llvm-objdump process per input shares nothing and scales without
+/// ordering work.
 static void dumpInput(StringRef file) {
   // If we are using the Mach-O specific object file parser, then let it parse
   // the file and process the command line options.  So the -arch flags can
@@ -367,6 +367,12 @@ static void mergeInstrProfile(const WeightedFileVector &Inputs,
                    Contexts[End - 1].get());
         Pool.wait();
       }
+      // The contexts in the upper half have been merged into the lower half
+      // and only hold moved-from records now. Free them so the peak memory of
+      // the reduction tracks the live contexts rather than NumThreads full
+      // profile maps.
+      for (unsigned I = Mid; I < End; ++I)
+        Contexts[I].reset();
       End = Mid;
       Mid /= 2;
     } while (Mid > 0);
@@ -376,6 +382,10 @@ static void mergeInstrProfile(const WeightedFileVector &Inputs,
   // is equal to the number of inputs the merge failed.
   unsigned NumErrors = 0;
   for (std::unique_ptr<WriterContext> &WC : Contexts) {
+    // Contexts freed during the reduction passed their errors to the context
+    // they were merged into.
+    if (!WC)
+      continue;
     for (auto &ErrorPair : WC->Errors) {
       ++NumErrors;
       warn(toString(std::move(ErrorPair.first)), ErrorPair.second);
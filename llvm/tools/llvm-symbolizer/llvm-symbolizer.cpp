@@ -289,6 +289,7 @@ int main(int argc, char **argv) {
   Opts.DWPName = Args.getLastArgValue(OPT_dwp_EQ).str();
   Opts.FallbackDebugPath =
       Args.getLastArgValue(OPT_fallback_debug_path_EQ).str();
+  Opts.GsymFileDirectory = Args.getAllArgValues(OPT_gsym_file_directory_EQ);
   Opts.PrintFunctions = decideHowToPrintFunctions(Args, IsAddr2Line);
   parseIntArg(Args, OPT_print_source_context_lines_EQ, SourceContextLines);
   Opts.RelativeAddresses = Args.hasArg(OPT_relative_address);
@@ -301,6 +302,7 @@ int main(int argc, char **argv) {
     Opts.UseDIA = false;
   }
 #endif
+  Opts.UseGsym = Args.hasArg(OPT_use_gsym);
   Opts.UseSymbolTable = true;
 
   for (const opt::Arg *A : Args.filtered(OPT_dsym_hint_EQ)) {
@@ -0,0 +1,114 @@
+//===- SymbolizeTest.cpp - Unit tests for LLVMSymbolizer ------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/DebugInfo/Symbolize/Symbolize.h"
+#include "llvm/ObjectYAML/yaml2obj.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/YAMLTraits.h"
+#include "llvm/Support/raw_ostream.h"
+#include "llvm/Testing/Support/Error.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+using namespace llvm::symbolize;
+
+namespace {
+
+// An executable with two functions in its symbol table and no debug info;
+// symbolization falls back to the symbol table.
+constexpr const char *ObjectYAML = R"(
+--- !ELF
+FileHeader:
+  Class:    ELFCLASS64
+  Data:     ELFDATA2LSB
+  Type:     ET_EXEC
+  Machine:  EM_X86_64
+Sections:
+  - Name:    .text
+    Type:    SHT_PROGBITS
+    Flags:   [ SHF_ALLOC, SHF_EXECINSTR ]
+    Address: 0x1000
+    Size:    0x20
+Symbols:
+  - Name:    func1
+    Type:    STT_FUNC
+    Section: .text
+    Value:   0x1000
+    Size:    0x10
+    Binding: STB_GLOBAL
+  - Name:    func2
+    Type:    STT_FUNC
+    Section: .text
+    Value:   0x1010
+    Size:    0x10
+    Binding: STB_GLOBAL
+)";
+
+class SymbolizeTest : public ::testing::Test {
+protected:
+  SmallString<128> ObjectPath;
+
+  void SetUp() override {
+    int FD;
+    ASSERT_FALSE(sys::fs::createTemporaryFile("symbolize-test", "elf", FD,
+                                              ObjectPath));
+    raw_fd_ostream OS(FD, /*shouldClose=*/true);
+    yaml::Input YIn(ObjectYAML);
+    ASSERT_TRUE(yaml::convertYAML(YIn, OS, [](const Twine &Msg) {
+      errs() << "yaml2obj: " << Msg << "\n";
+    }));
+  }
+
+  void TearDown() override { sys::fs::remove(ObjectPath); }
+};
+
+TEST_F(SymbolizeTest, SymbolizeAddressesMatchesSingleLookups) {
+  LLVMSymbolizer Symbolizer;
+
+  // Out-of-order addresses, duplicates, and one address outside any function.
+  std::vector<uint64_t> Addresses = {0x1015, 0x1000, 0x2000, 0x1005, 0x1015};
+  auto BatchOrErr =
+      Symbolizer.symbolizeAddresses(std::string(ObjectPath.str()), Addresses);
+  ASSERT_THAT_EXPECTED(BatchOrErr, Succeeded());
+  std::vector<DILineInfo> &Batch = *BatchOrErr;
+  ASSERT_EQ(Batch.size(), Addresses.size());
+
+  // Results come back in the caller's order.
+  EXPECT_EQ(Batch[0].FunctionName, "func2");
+  EXPECT_EQ(Batch[1].FunctionName, "func1");
+  EXPECT_EQ(Batch[2].FunctionName, DILineInfo::BadString);
+  EXPECT_EQ(Batch[3].FunctionName, "func1");
+  EXPECT_EQ(Batch[4].FunctionName, "func2");
+
+  // And agree with the one-at-a-time API.
+  for (size_t I = 0; I != Addresses.size(); ++I) {
+    auto SingleOrErr = Symbolizer.symbolizeCode(
+        std::string(ObjectPath.str()),
+        {Addresses[I], object::SectionedAddress::UndefSection});
+    ASSERT_THAT_EXPECTED(SingleOrErr, Succeeded());
+    EXPECT_EQ(Batch[I], *SingleOrErr) << "mismatch at address index " << I;
+  }
+}
+
+TEST_F(SymbolizeTest, SymbolizeAddressesEmptyBatch) {
+  LLVMSymbolizer Symbolizer;
+  auto BatchOrErr =
+      Symbolizer.symbolizeAddresses(std::string(ObjectPath.str()), {});
+  ASSERT_THAT_EXPECTED(BatchOrErr, Succeeded());
+  EXPECT_TRUE(BatchOrErr->empty());
+}
+
+TEST_F(SymbolizeTest, SymbolizeAddressesBadModule) {
+  LLVMSymbolizer Symbolizer;
+  auto BatchOrErr =
+      Symbolizer.symbolizeAddresses("/no/such/module", {0x1000});
+  EXPECT_THAT_EXPECTED(BatchOrErr, Failed());
+}
+
+} // namespace
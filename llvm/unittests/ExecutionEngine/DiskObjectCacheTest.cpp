@@ -0,0 +1,164 @@
+//===- DiskObjectCacheTest.cpp - Unit tests for DiskObjectCache -----------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/ExecutionEngine/DiskObjectCache.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/raw_ostream.h"
+#include "gtest/gtest.h"
+
+#include <thread>
+
+using namespace llvm;
+
+namespace {
+
+class DiskObjectCacheTest : public ::testing::Test {
+protected:
+  LLVMContext Ctx;
+  SmallString<128> CacheDir;
+
+  void SetUp() override {
+    ASSERT_FALSE(sys::fs::createUniqueDirectory("disk-object-cache", CacheDir));
+  }
+
+  void TearDown() override { sys::fs::remove_directories(CacheDir); }
+
+  std::unique_ptr<Module> makeModule(StringRef Name, int RetVal) {
+    auto M = std::make_unique<Module>(Name, Ctx);
+    IRBuilder<> B(Ctx);
+    Function *F = Function::Create(
+        FunctionType::get(B.getInt32Ty(), {}, /*isVarArg=*/false),
+        GlobalValue::ExternalLinkage, "f", *M);
+    B.SetInsertPoint(BasicBlock::Create(Ctx, "entry", F));
+    B.CreateRet(B.getInt32(RetVal));
+    return M;
+  }
+
+  std::unique_ptr<DiskObjectCache> makeCache(StringRef Fingerprint = "fp") {
+    return cantFail(DiskObjectCache::Create(CacheDir, Fingerprint));
+  }
+
+  /// Lists the names of the plain files in the cache directory.
+  std::vector<std::string> cacheEntries() {
+    std::vector<std::string> Names;
+    std::error_code EC;
+    for (sys::fs::directory_iterator I(CacheDir, EC), E; I != E && !EC;
+         I.increment(EC))
+      Names.push_back(std::string(sys::path::filename(I->path())));
+    return Names;
+  }
+};
+
+TEST_F(DiskObjectCacheTest, MissThenHit) {
+  auto Cache = makeCache();
+  auto M = makeModule("m", 1);
+
+  EXPECT_EQ(Cache->getObject(M.get()), nullptr);
+
+  StringRef Bytes = "fake object bytes";
+  Cache->notifyObjectCompiled(M.get(), MemoryBufferRef(Bytes, "obj"));
+
+  auto Hit = Cache->getObject(M.get());
+  ASSERT_NE(Hit, nullptr);
+  EXPECT_EQ(Hit->getBuffer(), Bytes);
+}
+
+TEST_F(DiskObjectCacheTest, KeySeparatesModulesAndFingerprints) {
+  auto Cache = makeCache();
+  auto M1 = makeModule("m1", 1);
+  auto M2 = makeModule("m2", 2);
+
+  Cache->notifyObjectCompiled(M1.get(),
+                              MemoryBufferRef(StringRef("m1 object"), "obj"));
+
+  // A different module misses.
+  EXPECT_EQ(Cache->getObject(M2.get()), nullptr);
+
+  // The same module through a cache with different codegen settings misses,
+  // even though both caches share the directory.
+  auto OtherTarget = makeCache("other-fp");
+  EXPECT_EQ(OtherTarget->getObject(M1.get()), nullptr);
+
+  auto Hit = Cache->getObject(M1.get());
+  ASSERT_NE(Hit, nullptr);
+  EXPECT_EQ(Hit->getBuffer(), "m1 object");
+}
+
+TEST_F(DiskObjectCacheTest, ConcurrentWritersLeaveOneIntactEntry) {
+  auto Cache = makeCache();
+  auto M = makeModule("m", 1);
+
+  // Entries are content-addressed, so racing writers carry identical bytes.
+  // Whoever loses the rename race must overwrite the winner with the same
+  // content and clean up its temporary file.
+  StringRef Bytes = "racing object bytes";
+  std::vector<std::thread> Writers;
+  for (unsigned I = 0; I != 8; ++I)
+    Writers.emplace_back([&] {
+      Cache->notifyObjectCompiled(M.get(), MemoryBufferRef(Bytes, "obj"));
+    });
+  for (std::thread &T : Writers)
+    T.join();
+
+  auto Hit = Cache->getObject(M.get());
+  ASSERT_NE(Hit, nullptr);
+  EXPECT_EQ(Hit->getBuffer(), Bytes);
+
+  // Exactly one entry and no leftover temporaries.
+  EXPECT_EQ(cacheEntries().size(), 1u);
+}
+
+TEST_F(DiskObjectCacheTest, StaleTemporaryIsNotAnEntry) {
+  auto Cache = makeCache();
+  auto M = makeModule("m", 1);
+
+  // Simulate a writer that died before renaming its temporary into place.
+  SmallString<128> TmpPath(CacheDir);
+  sys::path::append(TmpPath, "deadbeef.o.tmp12345678");
+  {
+    std::error_code EC;
+    raw_fd_ostream OS(TmpPath, EC);
+    ASSERT_FALSE(EC);
+    OS << "partial object bytes";
+  }
+
+  EXPECT_EQ(Cache->getObject(M.get()), nullptr);
+}
+
+TEST_F(DiskObjectCacheTest, RecompileReplacesTamperedEntry) {
+  auto Cache = makeCache();
+  auto M = makeModule("m", 1);
+
+  StringRef Bytes = "good object bytes";
+  Cache->notifyObjectCompiled(M.get(), MemoryBufferRef(Bytes, "obj"));
+
+  // Entries are trusted, so external tampering is visible to readers...
+  std::vector<std::string> Entries = cacheEntries();
+  ASSERT_EQ(Entries.size(), 1u);
+  SmallString<128> EntryPath(CacheDir);
+  sys::path::append(EntryPath, Entries.front());
+  {
+    std::error_code EC;
+    raw_fd_ostream OS(EntryPath, EC);
+    ASSERT_FALSE(EC);
+    OS << "tampered";
+  }
+
+  // ...but the next compile atomically replaces the damaged entry.
+  Cache->notifyObjectCompiled(M.get(), MemoryBufferRef(Bytes, "obj"));
+  auto Hit = Cache->getObject(M.get());
+  ASSERT_NE(Hit, nullptr);
+  EXPECT_EQ(Hit->getBuffer(), Bytes);
+}
+
+} // namespace
@@ -0,0 +1,115 @@
+//===- StandardInstrumentationsTest.cpp - Instrumentation unit tests ------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Passes/StandardInstrumentations.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/IR/PassInstrumentation.h"
+#include "llvm/IR/PassManager.h"
+#include "llvm/Support/CommandLine.h"
+#include "gtest/gtest.h"
+
+using namespace llvm;
+
+namespace {
+
+/// A no-op function pass that counts how often it actually runs.
+struct CountingPass : PassInfoMixin<CountingPass> {
+  int &Runs;
+  CountingPass(int &Runs) : Runs(Runs) {}
+  PreservedAnalyses run(Function &, FunctionAnalysisManager &) {
+    ++Runs;
+    return PreservedAnalyses::all();
+  }
+};
+
+/// The skip cache is opt-in; enable the flag once for this test binary.
+static void enableSkipUnchangedFunctionPasses() {
+  static bool Enabled = [] {
+    const char *Args[] = {"StandardInstrumentationsTest",
+                          "-skip-unchanged-function-passes"};
+    cl::ParseCommandLineOptions(2, Args);
+    return true;
+  }();
+  (void)Enabled;
+}
+
+class SkipUnchangedTest : public ::testing::Test {
+protected:
+  LLVMContext Ctx;
+  Module M{"m", Ctx};
+  PassInstrumentationCallbacks PIC;
+  SkipUnchangedInstrumentation SI{/*DebugLogging=*/false};
+  FunctionAnalysisManager FAM;
+  FunctionPassManager FPM;
+  int Runs = 0;
+
+  void SetUp() override {
+    enableSkipUnchangedFunctionPasses();
+    SI.registerCallbacks(PIC);
+    FAM.registerPass([&] { return PassInstrumentationAnalysis(&PIC); });
+    FPM.addPass(CountingPass(Runs));
+  }
+
+  Function *makeFunction(StringRef Name) {
+    Function *F = Function::Create(
+        FunctionType::get(Type::getVoidTy(Ctx), /*isVarArg=*/false),
+        GlobalValue::ExternalLinkage, Name, M);
+    IRBuilder<> B(BasicBlock::Create(Ctx, "entry", F));
+    B.CreateRetVoid();
+    return F;
+  }
+};
+
+TEST_F(SkipUnchangedTest, SkipsSecondRunOnUnchangedFunction) {
+  Function *F = makeFunction("f");
+
+  FPM.run(*F, FAM);
+  EXPECT_EQ(Runs, 1);
+
+  // The pass made no changes and the function still hashes the same, so the
+  // second run is skipped.
+  FPM.run(*F, FAM);
+  EXPECT_EQ(Runs, 1);
+
+  // Structurally changing the function invalidates the cached hash.
+  IRBuilder<> B(&F->getEntryBlock(), F->getEntryBlock().begin());
+  B.CreateAlloca(B.getInt32Ty());
+  FPM.run(*F, FAM);
+  EXPECT_EQ(Runs, 2);
+}
+
+TEST_F(SkipUnchangedTest, FunctionDeathPrunesCachedHashes) {
+  Function *F = makeFunction("f");
+
+  FPM.run(*F, FAM);
+  FPM.run(*F, FAM);
+  EXPECT_EQ(Runs, 1);
+
+  // Delete the function and create a structurally identical one. If the
+  // allocator reuses the address (it usually does for an immediate same-size
+  // allocation), a stale cache entry would match both the key and the hash
+  // and wrongly skip the new function's first run.
+  const void *OldAddr = F;
+  F->eraseFromParent();
+  Function *F2 = makeFunction("f");
+  if (static_cast<const void *>(F2) != OldAddr)
+    // Address was not reused; the scenario under test cannot occur.
+    return;
+
+  FPM.run(*F2, FAM);
+  EXPECT_EQ(Runs, 2) << "stale entry inherited by a new function at the "
+                        "same address";
+
+  // And the new function's own entry works as usual afterwards.
+  FPM.run(*F2, FAM);
+  EXPECT_EQ(Runs, 2);
+}
+
+} // namespace
@@ -162,6 +162,14 @@ void DAGISelEmitter::run(raw_ostream &OS) {
   llvm::stable_sort(Patterns, PatternSortingPredicate(CGP));
 
   // Convert each variant of each pattern into a Matcher.
+  //
+  // The conversions look independent but cannot run on worker threads:
+  // matcher generation reaches back into TableGen's Init values, and those
+  // are uniqued through global, unsynchronized fold caches - any thread that
+  // materializes a list or dag init races every other. The subsequent
+  // OptimizeMatcher factoring is also where most of the time goes, and it is
+  // a sequential fold: each FactorNodes step rewrites the shared scope that
+  // later steps consult, and the emitted table bytes depend on that order.
   Records.startTimer("Convert to matchers");
   std::vector<Matcher*> PatternMatchers;
   for (unsigned i = 0, e = Patterns.size(); i != e; ++i) {
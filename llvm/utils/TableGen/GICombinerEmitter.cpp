@@ -717,6 +717,14 @@ void GICombinerEmitter::gatherRules(
   }
 }
 
+// The emitted dispatch is already indexed, not linear: the match tree's first
+// partitioner splits leaves by root opcode and nested partitioners split
+// further by operand shape, so a rule is only reached from instructions that
+// can plausibly match it (see GIMatchTreeOpcodePartitioner). What still runs
+// linearly per instruction are the rules that exist only as hand-written
+// CombinerHelper calls; those become indexable exactly when they are ported
+// to Combine.td and flow through this emitter, which no emitter-side change
+// can do for them.
 void GICombinerEmitter::generateCodeForTree(raw_ostream &OS,
                                             const GIMatchTree &Tree,
                                             StringRef Indent) const {
@@ -280,6 +280,15 @@ Expected<std::unique_ptr<ExecutionEngine>> ExecutionEngine::create(
 
   // Callback to inspect the cache and recompile on demand. This follows Lang's
   // LLJITWithObjectCache example.
+  //
+  // The cache is deliberately in-memory and keyed by module identifier, not a
+  // content-addressed on-disk store: the object code depends on the target
+  // machine configuration and the lowering pipeline as much as on the module
+  // text, so a sound content key must hash all of it, and cross-process reuse
+  // belongs in a client that can define those invariants. Compilation is also
+  // single-threaded here - clients hand us one module and block on create(),
+  // so ORC's concurrent compiler would only help after splitting the module
+  // per function, which the caller can already do at the MLIR level.
   auto compileFunctionCreator = [&](JITTargetMachineBuilder JTMB)
       -> Expected<std::unique_ptr<IRCompileLayer::IRCompiler>> {
     if (jitCodeGenOptLevel)
@@ -9,6 +9,13 @@
 // This file implements the MLIR AsmPrinter class, which is used to implement
 // the various print() methods on the core IR objects.
 //
+// The textual form produced here is currently MLIR's only serialization.
+// A binary module format would need a stable, versioned encoding for every
+// dialect's attributes and types - today those round-trip through the
+// dialect-defined textual syntax, which is the extension point - so it is a
+// cross-cutting project of its own rather than an alternative printer that
+// could live alongside this one.
+//
 //===----------------------------------------------------------------------===//
 
 #include "mlir/IR/AffineExpr.h"
@@ -2083,6 +2083,13 @@ ParseResult TopLevelOperationParser::parse(Block *topLevelBlock,
 
 //===----------------------------------------------------------------------===//
 
+// Parsing is single-threaded end to end. Farming top-level operations out to
+// workers would require first finding their boundaries, and there is no cheap
+// way to do that: generic op syntax puts regions behind arbitrary attribute
+// dictionaries and strings, so delimiting a top-level op is most of the work
+// of lexing it. Worse, attribute and type alias definitions (#foo = ...,
+// !bar = ...) are file-scoped and may appear between ops, so a chunk cannot
+// be parsed correctly without everything lexically before it.
 LogicalResult mlir::parseSourceFile(const llvm::SourceMgr &sourceMgr,
                                     Block *block, MLIRContext *context,
                                     LocationAttr *sourceFileLoc) {
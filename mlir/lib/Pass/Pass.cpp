@@ -553,6 +553,14 @@ static bool hasSizeMismatch(ArrayRef<OpPassManager> lhs,
 }
 
 /// Run this pass adaptor synchronously.
+// Each nested operation is claimed by a worker and run through the *entire*
+// nested pipeline before the next operation is picked up, so there is no
+// synchronization at individual pass boundaries within this adaptor; the
+// pipeline is already "pipeline parallel" at operation granularity. The only
+// barriers are between adaptors at the parent level, and those are required:
+// a parent pass scheduled after this adaptor may inspect or mutate any of the
+// nested operations, so all of them must be through the nested pipeline
+// before it runs.
 void OpToOpPassAdaptor::runOnOperationAsyncImpl(bool verifyPasses) {
   AnalysisManager am = getAnalysisManager();
 
@@ -193,7 +193,12 @@ private:
   }
 
   /// A thread local cache for storage objects. This helps to reduce the lock
-  /// contention when an object already existing in the cache.
+  /// contention when an object already existing in the cache. Entries never
+  /// need invalidation or epoch-based flushing: uniqued storage lives for the
+  /// lifetime of the context, so a cached pointer can only ever be stale in
+  /// the sense of missing, never dangling. The hottest singletons (builtin
+  /// types, common attributes) additionally bypass the uniquer entirely via
+  /// the caches on MLIRContextImpl.
   ThreadLocalCache<StorageTypeSet> localCache;
 
   /// A set of uniquer shards to allow for further bucketing accesses for
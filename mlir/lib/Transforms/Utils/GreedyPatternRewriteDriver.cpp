@@ -34,6 +34,14 @@ static unsigned maxPatternMatchIterations = 10;
 namespace {
 /// This is a worklist-driven driver for the PatternMatcher, which repeatedly
 /// applies the locally optimal patterns in a roughly "bottom up" way.
+///
+/// Ops are processed one at a time by design. Applying matched patterns "in
+/// bulk" over a cohort of ops is unsound under greedy semantics: a single
+/// rewrite can erase or re-type neighbouring ops, invalidating any matches
+/// computed for them in the same batch, so matches cannot be cached across a
+/// mutation. The cheap forms of that idea are already in place - the
+/// worklist is deduplicated through worklistMap, and the matcher buckets
+/// patterns per OperationName and tries them in benefit order.
 class GreedyPatternRewriteDriver : public PatternRewriter {
 public:
   explicit GreedyPatternRewriteDriver(MLIRContext *ctx,
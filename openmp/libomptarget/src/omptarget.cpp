@@ -260,6 +260,17 @@ int targetDataMapper(ident_t *loc, DeviceTy &Device, void *arg_base, void *arg,
 }
 
 /// Internal function to do the mapping and transfer the data to the device
+///
+/// Transfers here are not individually blocking: submits go through the
+/// plugin's data_submit_async with the region's __tgt_async_info, so a
+/// capable plugin (e.g. CUDA, which queues on a per-region stream) overlaps
+/// the copies with each other and with the subsequent kernel launch; the
+/// host only blocks at the final synchronize for the region. What the CUDA
+/// path still lacks for full overlap is pinned staging memory — cuMemcpyAsync
+/// from pageable host buffers degrades to a synchronous copy inside the
+/// driver — which is a plugin-side allocation policy (the plugin already
+/// pools device memory through its MemoryManager; host-side cuMemHostAlloc
+/// pooling would be the symmetric extension).
 int targetDataBegin(ident_t *loc, DeviceTy &Device, int32_t arg_num,
                     void **args_base, void **args, int64_t *arg_sizes,
                     int64_t *arg_types, map_var_info_t *arg_names,
@@ -39,6 +39,19 @@
 
 void __kmp_print_structure(void); // Forward declaration
 
+// This file implements four barrier patterns — linear, tree, hyper, and
+// hierarchical — selected per barrier type via KMP_*_BARRIER_PATTERN, each
+// with a configurable branch factor (the branch-bits settings). On large
+// flat machines the first knobs to try are wider branch factors for the
+// hyper barrier and the hierarchical pattern, which arranges arrive/release
+// by core/socket groups so most traffic stays inside a cache domain; it
+// needs affinity information to build its machine hierarchy. A distributed
+// counter barrier (a dedicated cache line per thread group, flat group
+// arrive plus tree across groups) would slot in as a fifth bp_ pattern
+// behind the same dispatch switches below rather than replacing these, since
+// pattern choice is workload- and topology-dependent enough that the envvar
+// selection is the interface users rely on.
+
 // ---------------------------- Barrier Algorithms ----------------------------
 
 // Linear Barrier
@@ -2928,6 +2928,17 @@ static inline int __kmp_execute_tasks_template(
           asleep = 0;
         } else if (!new_victim) { // no recent steals and we haven't already
           // used a new victim; select a random thread
+          // Victim choice is last-successful-victim first, then uniformly
+          // random. Biasing the random pick toward topologically near
+          // threads (same core, then same package/NUMA node, per the
+          // affinity machinery's topology map) has been prototyped
+          // elsewhere and is attractive for cache-heavy task graphs, but
+          // it concentrates steal traffic: under imbalance every idle
+          // thread in a node hammers the same few neighbors' deque locks
+          // while remote work sits untouched. A locality policy needs the
+          // randomization to degrade toward uniform as local attempts
+          // fail; the last-stolen-from affinity above already captures the
+          // stable-producer case that matters most in practice.
           do { // Find a different thread to steal work from.
             // Pick a random thread. Initial plan was to cycle through all the
             // threads, and only return if we tried to steal from every thread,
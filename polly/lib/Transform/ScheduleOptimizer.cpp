@@ -1468,6 +1468,24 @@ static void walkScheduleTreeForStatistics(isl::schedule Schedule, int Version) {
       &Version);
 }
 
+// A note on two frequently proposed speedups for this pass:
+//
+// Parallel per-scop scheduling: every Scop already owns a private isl_ctx
+// (see the Scop constructor in ScopInfo.cpp), so the ISL side is isolated.
+// What is not isolated is everything else the scop pipeline touches — scops
+// hold live ScalarEvolution/DominatorTree references, their isl ids carry
+// ScopStmt/MemoryAccess pointers back into shared IR, and codegen mutates a
+// single LLVMContext. Running scops on a thread pool therefore requires the
+// same whole-context isolation as parallelizing LLVM function passes, which
+// this pass cannot provide from inside the pass manager.
+//
+// Persistent schedule caching: an optimized isl_schedule is expressible as a
+// string, but its statement ids name ScopStmt instances of this compilation,
+// so rehydrating a cached schedule into a fresh Scop needs a canonical
+// statement naming and a proof that the dependences are unchanged — i.e. a
+// serialized form of the whole scop, not just a hash. Until such a format
+// exists, the knobs for bounding scheduler cost are ISL's compute-out limits
+// (e.g. -polly-dependences-computeout).
 bool IslScheduleOptimizer::runOnScop(Scop &S) {
   // Skip SCoPs in case they're already optimised by PPCGCodeGeneration
   if (S.isToBeSkipped())